@@ -44,9 +44,113 @@
 #define APP_U8_DCM_R_DIR_CW_PIN		2
 #define	APP_U8_DCM_R_DIR_CCW_PIN	3
 
-/* Left DCM */
+/* Left DCM ( CCW Pin moved from P7 to P4, P7 is OC2, the DCM Speed (PWM) Pin ) */
 #define APP_U8_DCM_L_DIR_CW_PIN		6
-#define	APP_U8_DCM_L_DIR_CCW_PIN	7
+#define	APP_U8_DCM_L_DIR_CCW_PIN	4
+
+/* DCM Speed (PWM) Ports and Pins, one PWM Channel per DCM */
+/* Options: B/P3 : OC0 ( TMR0 )
+			D/P7 : OC2 ( TMR2 )
+ */
+/* Right DCM */
+#define APP_U8_DCM_R_SPEED_PORT		1
+#define APP_U8_DCM_R_SPEED_PIN		3
+
+/* Left DCM */
+#define APP_U8_DCM_L_SPEED_PORT		3
+#define APP_U8_DCM_L_SPEED_PIN		7
+
+/* DCM Polarities and Trims */
+/* Options: Polarity: DCM_U8_POLARITY_NORMAL
+					  DCM_U8_POLARITY_INVERTED : CW and CCW Pins swapped, for a DCM wired or mounted mirrored
+			Trim	: 0 to 100 % of the commanded speed, to slow down the faster DCM so the car runs straight
+ */
+/* Right DCM */
+#define APP_U8_DCM_R_POLARITY		DCM_U8_POLARITY_NORMAL
+#define APP_U8_DCM_R_TRIM			100
+/* Left DCM */
+#define APP_U8_DCM_L_POLARITY		DCM_U8_POLARITY_NORMAL
+#define APP_U8_DCM_L_TRIM			100
+
+/* US Trigger Port and Pin */
+/* Options: Any Port/Pin ( 10 us pulse generated by software )
+			D/P5 : OC1A, pulse generated by Timer1 hardware, exact width and no CPU time
+ */
+#define APP_U8_US_TRIGGER_PORT		3
+#define APP_U8_US_TRIGGER_PIN		5
+
+/* US Echo Sources ( same values as EN_ICU_Source ) */
+#define APP_U8_US_ECHO_INT2			2
+#define APP_U8_US_ECHO_ICP1			3
+
+/* US Echo Source */
+/* Options: APP_U8_US_ECHO_INT2 : External Interrupt 2 ( PB2 ), timer is read in the ISR
+			APP_U8_US_ECHO_ICP1 : Timer1 hardware Input Capture ( PD6 ), zero jitter, requires moving Left DCM CW pin off PD6
+ */
+#define APP_U8_US_ECHO_SOURCE		APP_U8_US_ECHO_INT2
+
+/* APP Control Tick Period ( in ms ), the state machine is stepped once every tick */
+#define APP_U16_CONTROL_TICK_MS		50
+
+/* APP Ultrasonic Sensors, index in the US sensors table ( only the front sensor is fitted ) */
+#define APP_U8_US_FRONT				0
+#define APP_U8_NUMBER_OF_US			1
+
+/* APP Auto Ranging Guard ( in ms ), quiet time between two measurements, a full cycle takes at most ( echo timeout + guard ) per sensor */
+#define APP_U16_RANGING_GUARD_MS	10
+
+/* APP Max. Age of a distance sample ( in ms ), older samples mean ranging stopped and the car is stopped */
+#define APP_U16_SAMPLE_MAX_AGE_MS	( 3 * APP_U8_NUMBER_OF_US * ( US_ECHO_TIMEOUT_MS + APP_U16_RANGING_GUARD_MS ) )
+
+/* APP Tasks' Periods ( in ms ), Display Period is the LCD refresh rate ( 200 ms : 5 Hz ), independent of the Control Tick */
+#define APP_U16_MOTOR_PERIOD_MS		10
+#define APP_U16_DISPLAY_PERIOD_MS	200
+#define APP_U16_KEYPAD_PERIOD_MS	20
+
+/* APP Display Distance Step ( in cm ), the displayed distance is updated only once the distance moves by this step or more */
+#define APP_U16_DISPLAY_DISTANCE_STEP_CM	1
+
+/* APP Distance Thresholds ( in cm ) */
+#define APP_U16_FAR_DISTANCE		70
+#define APP_U16_NEAR_DISTANCE		30
+#define APP_U16_CRITICAL_DISTANCE	20
+
+/* APP Distance Hysteresis ( in cm ), distance must exceed a threshold by this band before a farther zone is entered */
+#define APP_U16_HYSTERESIS			3
+
+/* APP Car Speeds ( in % ) */
+#define APP_U8_SLOW_SPEED			30
+#define APP_U8_FAST_SPEED			50
+
+/* APP Inner Wheel Speed of the arcing avoidance turn ( Second State ), the outer wheel runs at the slow speed */
+#define APP_U8_ARC_INNER_SPEED		10
+
+/* APP State Durations ( in ms ) */
+#define APP_U16_SLOW_CRUISE_TIME_MS	5000
+#define APP_U16_TURN_TIME_MS		600
+
+/* APP Setup Durations ( in ms ) */
+#define APP_U16_SELECT_TIME_MS		5000
+#define APP_U16_START_DELAY_MS		2000
+
+/* APP LCD Benchmark, at start up, writes APP_U8_LCD_BENCHMARK_CHARS characters and displays the LCD throughput ( k characters per second ),
+   with the LCD queued Write Mode it is the caller side throughput ( characters must fit in the LCD queue ),
+   then displays the time ( us ) of formatting APP_U8_LCD_BENCHMARK_CHARS numbers with the float and with the fixed point routines */
+/* Options: 0 : Disabled
+			1 : Enabled
+ */
+#define APP_U8_LCD_BENCHMARK		0
+#define APP_U8_LCD_BENCHMARK_CHARS	32
+
+/* APP DCM Commands Statistics, Display Task shows on the second line, instead of the distance, the DCM target commands of the control loop
+   that were redundant ( H: hits, skipped ) and that changed a target ( M: misses ) */
+/* Options: 0 : Disabled
+			1 : Enabled
+ */
+#define APP_U8_DCM_STATS_DISPLAY	0
+
+/* APP Max. Number of Turns before waiting for the obstacle to be removed */
+#define APP_U8_MAX_TURNS			4
 
 /* End of Configurations */
 
@@ -15,11 +15,12 @@
 /* LIB */
 #include "../LIB/std_types/std_types.h"
 #include "../LIB/bit_math/bit_math.h"
+#include "../LIB/sch/sch_interface.h"
+#include "../LIB/swt/swt_interface.h"
 
 /* MCAL */
 #include "../MCAL/dio/dio_interface.h"
 #include "../MCAL/gli/gli_interface.h"
-#include "../MCAL/tmr0/tmr0_interface.h"
 
 /* HAL */
 #include "../HAL/btn/btn_interface.h"
@@ -28,12 +29,69 @@
 #include "../HAL/dcm/dcm_interface.h"
 #include "../HAL/us/us_interface.h"
 
+/*******************************************************************************************************************************************************************/
+/* APP Macros */
+
+/* APP States */
+#define APP_U8_STATE_STOP				0	/* Car stopped, distance is re-evaluated */
+#define APP_U8_STATE_FIRST_SLOW			1	/* First State: Distance > 70 cm, moving forward at 30% for 5 sec. */
+#define APP_U8_STATE_FIRST_FAST			2	/* First State: Distance > 70 cm, moving forward at 50% */
+#define APP_U8_STATE_SECOND				3	/* Second State: 30 < Distance <= 70 cm, arcing forward at 30% ( outer wheel ) in the default rotation */
+#define APP_U8_STATE_THIRD				4	/* Third State: 20 < Distance <= 30 cm, moving backward at 30% */
+#define APP_U8_STATE_TURN				5	/* Third and Fourth States: rotating for 600 ms in the default rotation */
+#define APP_U8_STATE_FOURTH				6	/* Fourth State: Distance <= 20 cm after max. turns, waiting for obstacle removal */
+#define APP_U8_STATE_PAUSE				7	/* Car stopped by user ( Key 2 ), until resumed ( Key 1 ) */
+#define APP_U8_NUMBER_OF_STATES			8
+#define APP_U8_STATE_ANY				0xFF	/* Transitions' Current State: any State but the Next State */
+
+/* APP Distance Zones ( ordered from farthest to nearest ) */
+#define APP_U8_ZONE_FAR					0	/* Distance > 70 cm */
+#define APP_U8_ZONE_MID					1	/* 30 < Distance <= 70 cm */
+#define APP_U8_ZONE_NEAR				2	/* 20 < Distance <= 30 cm */
+#define APP_U8_ZONE_CRITICAL			3	/* Distance <= 20 cm */
+
+/* APP Events */
+#define APP_U8_EVENT_ZONE_FAR			0
+#define APP_U8_EVENT_ZONE_MID			1
+#define APP_U8_EVENT_ZONE_NEAR			2
+#define APP_U8_EVENT_ZONE_CRITICAL		3
+#define APP_U8_EVENT_TIMEOUT			4
+#define APP_U8_EVENT_BLOCKED			5
+#define APP_U8_EVENT_PAUSE				6
+#define APP_U8_EVENT_RESUME				7
+#define APP_U8_EVENT_NONE				0xFF
+
+/* APP State Durations ( in Control Ticks ) */
+#define APP_U16_SLOW_CRUISE_TICKS		( APP_U16_SLOW_CRUISE_TIME_MS / APP_U16_CONTROL_TICK_MS )
+#define APP_U16_TURN_TICKS				( APP_U16_TURN_TIME_MS / APP_U16_CONTROL_TICK_MS )
+
+/* APP State Actions, any action may be NULL */
+typedef struct
+{
+	void ( *pf_g_entryAction ) ( void );	/* Called once when the state is entered */
+	u8   ( *pf_g_tickAction  ) ( void );	/* Called every control tick, returns an Event or APP_U8_EVENT_NONE */
+	void ( *pf_g_exitAction  ) ( void );	/* Called once when the state is left */
+} APP_ST_STATE;
+
+/* APP State Transitions */
+typedef struct
+{
+	u8 u8_g_currentState;
+	u8 u8_g_event;
+	u8 u8_g_nextState;
+} APP_ST_TRANSITION;
+
 /*******************************************************************************************************************************************************************/
 /* APP Functions' Prototypes */
 
 void APP_initialization( void );
 void APP_startProgram  ( void );
-void APP_stopCar	   ( void );
+
+/* APP Tasks, released by SCH */
+void APP_controlTick   ( void );
+void APP_motorTask	   ( void );
+void APP_displayTask   ( void );
+void APP_keypadTask	   ( void );
 
 /*******************************************************************************************************************************************************************/
 
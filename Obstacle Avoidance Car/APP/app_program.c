@@ -6,22 +6,188 @@
 *  Description: This file contains all Application (APP) functions' implementation.
 */
 
+/* LIB */
+#include "../LIB/sch/sch_config.h"
+#include "../LIB/swt/swt_config.h"
+
+/* MCAL */
+#include "../MCAL/pwm/pwm_config.h"
+
+/* HAL */
+#include "../HAL/dcm/dcm_config.h"
+
 /* APP */
 #include "app_config.h"
 #include "app_interface.h"
 
+/* ICP1 shares PD6 with the Left DCM CW pin */
+#if ( APP_U8_US_ECHO_SOURCE == APP_U8_US_ECHO_ICP1 ) && ( APP_U8_DCM_L_DIR_CW_PORT == 3 ) && ( APP_U8_DCM_L_DIR_CW_PIN == 6 )
+#error "APP: ICP1 echo source ( PD6 ) conflicts with the Left DCM CW pin"
+#endif
+
+/* OC0 ( PB3 ) PWM needs TMR0, which is the system tick unless the tick is moved to TMR1 */
+#if ( SWT_U8_TICK_SOURCE == SWT_U8_TICK_SOURCE_TMR0 ) && \
+	( ( ( APP_U8_DCM_R_SPEED_PORT == 1 ) && ( APP_U8_DCM_R_SPEED_PIN == 3 ) ) || ( ( APP_U8_DCM_L_SPEED_PORT == 1 ) && ( APP_U8_DCM_L_SPEED_PIN == 3 ) ) )
+#error "APP: OC0 ( PB3 ) DCM speed pin needs SWT_U8_TICK_SOURCE_TMR1"
+#endif
+
+/* PWM ISR Load Measurement reads TCNT1, which is free running with the TMR1 system tick only */
+#if ( PWM_U8_ISR_LOAD_MEASURE == 1 ) && ( SWT_U8_TICK_SOURCE != SWT_U8_TICK_SOURCE_TMR1 )
+#error "APP: PWM_U8_ISR_LOAD_MEASURE needs SWT_U8_TICK_SOURCE_TMR1"
+#endif
+
+/* A zero step would update the Display Model on every distance reading */
+#if ( APP_U16_DISPLAY_DISTANCE_STEP_CM == 0 )
+#error "APP: APP_U16_DISPLAY_DISTANCE_STEP_CM must be 1 cm or more"
+#endif
+
 /*******************************************************************************************************************************************************************/
 /* Declaration and Initialization */
 
-DCM_ST_CONFIG ast_g_DCMs[2] =
+DCM_ST_CONFIG ast_g_DCMs[DCM_U8_NUMBER_OF_DCM] =
 {
-	{ APP_U8_DCM_R_DIR_CW_PORT, APP_U8_DCM_R_DIR_CW_PIN, APP_U8_DCM_R_DIR_CCW_PORT, APP_U8_DCM_R_DIR_CCW_PIN },
-	{ APP_U8_DCM_L_DIR_CW_PORT, APP_U8_DCM_L_DIR_CW_PIN, APP_U8_DCM_L_DIR_CCW_PORT, APP_U8_DCM_L_DIR_CCW_PIN }
+	/* DCM_U8_RIGHT_DCM, then DCM_U8_LEFT_DCM */
+	{ APP_U8_DCM_R_DIR_CW_PORT, APP_U8_DCM_R_DIR_CW_PIN, APP_U8_DCM_R_DIR_CCW_PORT, APP_U8_DCM_R_DIR_CCW_PIN, APP_U8_DCM_R_SPEED_PORT, APP_U8_DCM_R_SPEED_PIN, APP_U8_DCM_R_POLARITY, APP_U8_DCM_R_TRIM },
+	{ APP_U8_DCM_L_DIR_CW_PORT, APP_U8_DCM_L_DIR_CW_PIN, APP_U8_DCM_L_DIR_CCW_PORT, APP_U8_DCM_L_DIR_CCW_PIN, APP_U8_DCM_L_SPEED_PORT, APP_U8_DCM_L_SPEED_PIN, APP_U8_DCM_L_POLARITY, APP_U8_DCM_L_TRIM }
 };
  
+const ST_US_ConfigType ast_g_USs[APP_U8_NUMBER_OF_US] =
+{
+	/* Trigger Port, Trigger Pin, Echo Source */
+	{ APP_U8_US_TRIGGER_PORT, APP_U8_US_TRIGGER_PIN, ( EN_ICU_Source ) APP_U8_US_ECHO_SOURCE }
+};
+
 /* Global variable to store appMode */
 u8 u8_g_select = APP_U8_CAR_ROTATE_RGT;
- 
+
+/* Global variables to store the state machine status */
+static u8  u8_gs_currentState = APP_U8_STATE_STOP;
+static u8  u8_gs_distanceZone = APP_U8_ZONE_CRITICAL;
+static u16 u16_gs_distance    = 0;
+static u16 u16_gs_stateTicks  = 0;
+static u8  u8_gs_turnsCounter = 0;
+
+/* Global variable to store the last key event, set by Keypad Task and consumed by Control Task */
+static u8  u8_gs_keyEvent = APP_U8_EVENT_NONE;
+
+/* Global variables to store the commanded motion, set by Control Task and applied by Motor Task */
+static u8  u8_gs_rightSpeed		= APP_U8_SLOW_SPEED;
+static u8  u8_gs_leftSpeed		= APP_U8_SLOW_SPEED;
+static u8  u8_gs_rightDirection = DCM_U8_STOP;
+static u8  u8_gs_leftDirection	= DCM_U8_STOP;
+static u8  u8_gs_motorUpdate	= 0;
+
+/* Global variables of the Display Model, set by the control path and rendered by Display Task once changed */
+static u8  u8_gs_displaySpeed	  = 0;
+static u8  u8_gs_displayDirection = 'S';
+static u16 u16_gs_displayDistance = 0;
+static u8  u8_gs_displayUpdate	  = 1;
+
+/* Global variables to store the LCD bytes sent by the last Display Tick and the max. ever, bus traffic ( 0 when nothing changed ) */
+static u8  u8_gs_displayBytes	 = 0;
+static u8  u8_gs_maxDisplayBytes = 0;
+
+/* Global Array of Tasks, index is priority ( 0 is highest ) */
+static const SCH_ST_TASK_CONFIG Ast_gs_tasks[SCH_U8_NUMBER_OF_TASKS] =
+{
+	/* Task				Period ( ms )				 Offset ( ms ) */
+	{ APP_controlTick,	APP_U16_CONTROL_TICK_MS,	 0 },
+	{ APP_motorTask,	APP_U16_MOTOR_PERIOD_MS,	 0 },
+	{ APP_keypadTask,	APP_U16_KEYPAD_PERIOD_MS,	 3 },
+	{ APP_displayTask,	APP_U16_DISPLAY_PERIOD_MS,	 7 }
+};
+
+/*******************************************************************************************************************************************************************/
+/* APP Private Functions' Prototypes */
+
+static void APP_readDistance   ( void );
+static void APP_enterStop	   ( void );
+static void APP_enterFirstSlow ( void );
+static void APP_enterFirstFast ( void );
+static void APP_enterSecond	   ( void );
+static void APP_enterThird	   ( void );
+static void APP_enterTurn	   ( void );
+static void APP_enterPause	   ( void );
+static u8   APP_tickStop	   ( void );
+static u8   APP_tickFirstSlow  ( void );
+static u8   APP_tickTurn	   ( void );
+static void APP_exitFourth	   ( void );
+static void APP_exitPause	   ( void );
+
+static void APP_moveCar		   ( u8 u8_a_speed, u8 u8_a_rightDirection, u8 u8_a_leftDirection, u8 u8_a_directionChar );
+static void APP_arcCar		   ( u8 u8_a_rightSpeed, u8 u8_a_leftSpeed, u8 u8_a_directionChar );
+static void APP_setDisplayMotion   ( u8 u8_a_speed, u8 u8_a_directionChar );
+static void APP_setDisplayDistance ( u16 u16_a_distance );
+static u8   APP_classifyDistance( u16 u16_a_distance, u8 u8_a_currentZone );
+static u8   APP_dispatchEvent  ( u8 u8_a_event );
+#if APP_U8_LCD_BENCHMARK == 1
+static void APP_benchmarkLCD   ( void );
+#endif
+#if PWM_U8_TIMING_BENCHMARK == 1
+static void APP_benchmarkPWM   ( void );
+#endif
+#if PWM_U8_ISR_LOAD_MEASURE == 1
+static void APP_measurePWMLoad ( void );
+#endif
+#if ( APP_U8_LCD_BENCHMARK == 1 ) || ( PWM_U8_TIMING_BENCHMARK == 1 ) || ( PWM_U8_ISR_LOAD_MEASURE == 1 )
+
+/* Benchmark results are displayed as u16, larger values are shown as 65535 */
+#define APP_BENCHMARK_CLAMP_U16( VALUE )	( ( ( VALUE ) > 0xFFFF ) ? 0xFFFF : ( u16 ) ( VALUE ) )
+#endif
+
+/*******************************************************************************************************************************************************************/
+/* APP State and Transition Tables */
+
+/* Global Array of States' Actions, indexed by State */
+static const APP_ST_STATE Ast_gs_states[APP_U8_NUMBER_OF_STATES] =
+{
+	/* Entry Action		  Tick Action		 Exit Action */
+	{ APP_enterStop,	  APP_tickStop,		 NULL			},	/* APP_U8_STATE_STOP */
+	{ APP_enterFirstSlow, APP_tickFirstSlow, NULL			},	/* APP_U8_STATE_FIRST_SLOW */
+	{ APP_enterFirstFast, NULL,				 NULL			},	/* APP_U8_STATE_FIRST_FAST */
+	{ APP_enterSecond,	  NULL,				 NULL			},	/* APP_U8_STATE_SECOND */
+	{ APP_enterThird,	  NULL,				 NULL			},	/* APP_U8_STATE_THIRD */
+	{ APP_enterTurn,	  APP_tickTurn,		 NULL			},	/* APP_U8_STATE_TURN */
+	{ APP_enterStop,	  NULL,				 APP_exitFourth },	/* APP_U8_STATE_FOURTH */
+	{ APP_enterPause,	  NULL,				 APP_exitPause	}	/* APP_U8_STATE_PAUSE */
+};
+
+/* Global Array of Transitions, searched in order ( first match wins ), ( State, Event ) pairs not listed keep the current State */
+static const APP_ST_TRANSITION Ast_gs_transitions[] =
+{
+	/* Current State			Event						Next State */
+	{ APP_U8_STATE_PAUSE,		APP_U8_EVENT_RESUME,		APP_U8_STATE_STOP		},
+	{ APP_U8_STATE_ANY,			APP_U8_EVENT_PAUSE,			APP_U8_STATE_PAUSE		},
+
+	{ APP_U8_STATE_STOP,		APP_U8_EVENT_BLOCKED,		APP_U8_STATE_FOURTH		},
+	{ APP_U8_STATE_STOP,		APP_U8_EVENT_ZONE_FAR,		APP_U8_STATE_FIRST_SLOW },
+	{ APP_U8_STATE_STOP,		APP_U8_EVENT_ZONE_MID,		APP_U8_STATE_SECOND		},
+	{ APP_U8_STATE_STOP,		APP_U8_EVENT_ZONE_NEAR,		APP_U8_STATE_THIRD		},
+	{ APP_U8_STATE_STOP,		APP_U8_EVENT_ZONE_CRITICAL, APP_U8_STATE_TURN		},
+
+	{ APP_U8_STATE_FIRST_SLOW,	APP_U8_EVENT_TIMEOUT,		APP_U8_STATE_FIRST_FAST },
+	{ APP_U8_STATE_FIRST_SLOW,	APP_U8_EVENT_ZONE_MID,		APP_U8_STATE_SECOND		},
+	{ APP_U8_STATE_FIRST_SLOW,	APP_U8_EVENT_ZONE_NEAR,		APP_U8_STATE_STOP		},
+	{ APP_U8_STATE_FIRST_SLOW,	APP_U8_EVENT_ZONE_CRITICAL, APP_U8_STATE_STOP		},
+
+	{ APP_U8_STATE_FIRST_FAST,	APP_U8_EVENT_ZONE_MID,		APP_U8_STATE_SECOND		},
+	{ APP_U8_STATE_FIRST_FAST,	APP_U8_EVENT_ZONE_NEAR,		APP_U8_STATE_STOP		},
+	{ APP_U8_STATE_FIRST_FAST,	APP_U8_EVENT_ZONE_CRITICAL, APP_U8_STATE_STOP		},
+
+	{ APP_U8_STATE_SECOND,		APP_U8_EVENT_ZONE_FAR,		APP_U8_STATE_FIRST_SLOW },
+	{ APP_U8_STATE_SECOND,		APP_U8_EVENT_ZONE_NEAR,		APP_U8_STATE_STOP		},
+	{ APP_U8_STATE_SECOND,		APP_U8_EVENT_ZONE_CRITICAL, APP_U8_STATE_STOP		},
+
+	{ APP_U8_STATE_THIRD,		APP_U8_EVENT_ZONE_FAR,		APP_U8_STATE_TURN		},
+	{ APP_U8_STATE_THIRD,		APP_U8_EVENT_ZONE_MID,		APP_U8_STATE_TURN		},
+
+	{ APP_U8_STATE_TURN,		APP_U8_EVENT_TIMEOUT,		APP_U8_STATE_STOP		},
+
+	{ APP_U8_STATE_FOURTH,		APP_U8_EVENT_ZONE_FAR,		APP_U8_STATE_STOP		},
+	{ APP_U8_STATE_FOURTH,		APP_U8_EVENT_ZONE_MID,		APP_U8_STATE_STOP		},
+	{ APP_U8_STATE_FOURTH,		APP_U8_EVENT_ZONE_NEAR,		APP_U8_STATE_STOP		}
+};
+
 /*******************************************************************************************************************************************************************/
 /*
  Name: APP_initialization
@@ -34,12 +200,18 @@ void APP_initialization(void)
 	/* MCAL Initialization */
 	GLI_enableGIE();
 	
+	/* LIB Initialization ( system tick is needed by HAL delays ) */
+	SWT_initialization();
+	
 	/* HAL Initialization */
 	BTN_init( C, P4 );
 	LCD_init();
 	KPD_initialization();
-	US_init( B, P3, EN_INT2 );
+	US_init( ast_g_USs, APP_U8_NUMBER_OF_US );
 	DCM_initialization( ast_g_DCMs );
+	
+	/* Scheduler Initialization ( started by APP_startProgram, once the blocking start up is done ) */
+	SCH_initialization( Ast_gs_tasks );
 }
 
 /*******************************************************************************************************************************************************************/
@@ -53,29 +225,46 @@ void APP_startProgram  (void)
 {
 	u8 u8_l_keyValue = KPD_U8_KEY_NOT_PRESSED;
 	u8 u8_l_btnValue;
+	u8 u8_l_timerId, u8_l_timeoutFlag = 0;
 
+	#if APP_U8_LCD_BENCHMARK == 1
+	APP_benchmarkLCD();
+	#endif
+	
+	#if PWM_U8_TIMING_BENCHMARK == 1
+	APP_benchmarkPWM();
+	#endif
+	
+	#if PWM_U8_ISR_LOAD_MEASURE == 1
+	APP_measurePWMLoad();
+	#endif
+	
+	/* Blocking wait, only before SCH is started */
 	while ( u8_l_keyValue != '1' )
 	{
 		KPD_getPressedKey( &u8_l_keyValue );
 	}
 	
-	TMR0_timeoutMS( 5000 );
+	SWT_createTimer( &u8_l_timerId );
+	SWT_startTimer( u8_l_timerId, APP_U16_SELECT_TIME_MS, SWT_U8_MODE_ONE_SHOT, NULL );
 	
-	LCD_setCursor( 0, 0 );
-	LCD_sendString( ( u8* ) "Set Def. Rot." );
+	LCD_writeFrameString( 0, 0, ( u8* ) "Set Def. Rot." );
 	
-	while( !g_timeout_flag )
+	while( !u8_l_timeoutFlag )
 	{
-		LCD_setCursor( 1, 0 );
+		SWT_isExpired( u8_l_timerId, &u8_l_timeoutFlag );
 		
+		/* Flush sends only the changed cells, nothing while the rotation is not changed */
 		if ( u8_g_select == APP_U8_CAR_ROTATE_RGT )
 		{
-			LCD_sendString( ( u8* ) "Right" );
+			LCD_writeFrameString( 1, 0, ( u8* ) "Right" );
 		}
 		else
 		{
-			LCD_sendString( ( u8* ) "Left" );
+			LCD_writeFrameString( 1, 0, ( u8* ) "Left " );
 		}
+		
+		LCD_flushFrame();
 
 		BTN_read( C, P4, &u8_l_btnValue );
 		
@@ -90,272 +279,615 @@ void APP_startProgram  (void)
 		}
 	}
 	
-	LCD_clear();
-
-	DCM_controlDCMSpeed( 30 );
-	DCM_controlDCM( &ast_g_DCMs[0], DCM_U8_STOP );
-	DCM_controlDCM( &ast_g_DCMs[1], DCM_U8_STOP );
+	LCD_clearFrame();
+	LCD_writeFrameString( 0, 0, ( u8* ) "Speed:00% Dir:S" );
+	LCD_flushFrame();
 	
-	LCD_setCursor( 0, 0 );
-	LCD_sendString( ( u8* ) "Speed:00% Dir:S" );
+	SWT_delayMS( APP_U16_START_DELAY_MS );
 	
-	TMR0_delayMS( 2000 );
+	#if APP_U8_DCM_STATS_DISPLAY == 1
+	LCD_writeFrameString( 1, 0, ( u8* ) "H:      M:" );
+	#else
+	LCD_writeFrameString( 1, 0, ( u8* ) "Dist.:     cm" );
+	#endif
+	LCD_flushFrame();
 	
-	u16 u16_l_distance = 0;
+	/* Step 1: Classify the first reading without hysteresis, then enter the initial State */
+	u16_gs_distance = US_readDistance( APP_U8_US_FRONT );
+	u8_gs_distanceZone = APP_classifyDistance( u16_gs_distance, APP_U8_ZONE_CRITICAL );
+	APP_setDisplayDistance( u16_gs_distance );
 	
-	u16_l_distance = US_readDistance();
+	/* Step 2: Keep measuring in the background, Control Tick reads the latest sample */
+	US_startAutoRanging( APP_U16_RANGING_GUARD_MS );
 	
-	LCD_setCursor( 1, 0 );
+	u8_gs_currentState = APP_U8_STATE_STOP;
+	Ast_gs_states[APP_U8_STATE_STOP].pf_g_entryAction();
 	
-	LCD_sendString( ( u8* ) "Dist.:     cm");
-	LCD_setCursor( 1, 7 );
-	LCD_floatToString( u16_l_distance );
+	/* Step 3: Start releasing Tasks only now, the blocking start up above would count as Tasks' overruns */
+	SCH_start();
 	
-	/* Toggle forever */
+	/* Loop: Run the Tasks released by SCH */
 	while (1)
 	{
-		/************************************************************************************/
-		/*****************************First State********************************************/
-		/************************************************************************************/
-		u16_l_distance = US_readDistance();
-		
-		LCD_setCursor( 1, 7 );
-		LCD_floatToString(u16_l_distance);
-			
-		if ( u16_l_distance > 70 )
-		{
-			TMR0_timeoutMS( 5000 );
-			
-			while( !g_timeout_flag && u16_l_distance > 70 )
-			{
-				DCM_controlDCMSpeed( 30 );
-				DCM_controlDCM( &ast_g_DCMs[0], DCM_U8_ROTATE_CW );
-				DCM_controlDCM( &ast_g_DCMs[1], DCM_U8_ROTATE_CW );
-				
-				u16_l_distance = US_readDistance();
-				
-				LCD_setCursor( 0, 6 );
-				LCD_sendString( ( u8* ) "30" );
-				LCD_setCursor( 0,14 );
-				LCD_sendCharacter( 'F' );
-				LCD_setCursor( 1, 7 );
-				LCD_floatToString( u16_l_distance );
-				
-				APP_stopCar();
-			}
-			while( u16_l_distance > 70 )
-			{
-				DCM_controlDCMSpeed( 50 );
-				DCM_controlDCM( &ast_g_DCMs[0], DCM_U8_ROTATE_CW );
-				DCM_controlDCM( &ast_g_DCMs[1], DCM_U8_ROTATE_CW );
-				
-				u16_l_distance = US_readDistance();
-				
-				LCD_setCursor( 0, 6 );
-				LCD_sendString( ( u8* ) "50" );
-				LCD_setCursor( 0, 14 );
-				LCD_sendCharacter( 'F' );
-				LCD_setCursor( 1, 7 );
-				LCD_floatToString( u16_l_distance );
-				
-				APP_stopCar();
-			}
-		}
-		/************************************************************************************/
-		/*****************************Second State*******************************************/
-		/************************************************************************************/
-		else if ( ( u16_l_distance <= 70 ) && ( u16_l_distance > 30 ) )
-		{
-			DCM_controlDCMSpeed( 30 );
-			DCM_controlDCM( &ast_g_DCMs[0], DCM_U8_ROTATE_CW );
-			DCM_controlDCM( &ast_g_DCMs[1], DCM_U8_ROTATE_CW );
-			
-			u16_l_distance = US_readDistance();
-			
-			LCD_setCursor( 0, 6 );
-			LCD_sendString( ( u8* ) "30" );
-			LCD_setCursor( 0, 14 );
-			LCD_sendCharacter( 'F' );
-			LCD_setCursor( 1, 7 );
-			LCD_floatToString( u16_l_distance );
-			
-			APP_stopCar();
-		}
-		/************************************************************************************/
-		/*****************************Third State********************************************/
-		/************************************************************************************/
-		else if ( ( u16_l_distance <= 30 ) && ( u16_l_distance > 20 ) )
+		SCH_dispatchTasks();
+	}
+}
+
+/*******************************************************************************************************************************************************************/
+/*
+ Name: APP_controlTick
+ Input: void
+ Output: void
+ Description: Function to step the control state machine once, it never waits on a State, therefore every obstacle is handled within one control tick.
+*/
+void APP_controlTick   ( void )
+{
+	u8 u8_l_event;
+	
+	/* Step 1: Update distance zone of the latest distance sample */
+	APP_readDistance();
+	
+	u8_gs_distanceZone = APP_classifyDistance( u16_gs_distance, u8_gs_distanceZone );
+	
+	/* Step 2: Count ticks spent in the current State */
+	if ( u16_gs_stateTicks < 0xFFFF )
+	{
+		u16_gs_stateTicks++;
+	}
+	
+	/* Step 3: Get the event of the highest priority, User -> State -> Distance */
+	u8_l_event = u8_gs_keyEvent;
+	u8_gs_keyEvent = APP_U8_EVENT_NONE;
+	
+	if ( ( u8_l_event == APP_U8_EVENT_NONE ) && ( Ast_gs_states[u8_gs_currentState].pf_g_tickAction != NULL ) )
+	{
+		u8_l_event = Ast_gs_states[u8_gs_currentState].pf_g_tickAction();
+	}
+	
+	/* Step 4: Take the transition, if any, otherwise fall back to the distance zone event */
+	if ( ( u8_l_event == APP_U8_EVENT_NONE ) || ( APP_dispatchEvent( u8_l_event ) == STD_TYPES_NOK ) )
+	{
+		APP_dispatchEvent( APP_U8_EVENT_ZONE_FAR + u8_gs_distanceZone );
+	}
+}
+
+/*******************************************************************************************************************************************************************/
+/*
+ Name: APP_dispatchEvent
+ Input: u8 Event
+ Output: u8 Transition Taken ( OK ) or Not ( NOK )
+ Description: Function to search the Transitions table for the current State and Event, then run Exit and Entry Actions.
+*/
+static u8 APP_dispatchEvent  ( u8 u8_a_event )
+{
+	/* Define local variable to set the transition state = NOK */
+	u8 u8_l_transitionState = STD_TYPES_NOK;
+	
+	/* Loop: Until a matching Transition is found */
+	for ( u8 u8_l_index = 0; u8_l_index < ( sizeof( Ast_gs_transitions ) / sizeof( Ast_gs_transitions[0] ) ); u8_l_index++ )
+	{
+		/* Check 1: Transition matches the current State ( or any other State, it does not re-enter the current State ) and the Event */
+		if ( ( ( Ast_gs_transitions[u8_l_index].u8_g_currentState == u8_gs_currentState ) ||
+			   ( ( Ast_gs_transitions[u8_l_index].u8_g_currentState == APP_U8_STATE_ANY ) &&
+				 ( Ast_gs_transitions[u8_l_index].u8_g_nextState != u8_gs_currentState ) ) ) &&
+			 ( Ast_gs_transitions[u8_l_index].u8_g_event == u8_a_event ) )
 		{
-			DCM_controlDCMSpeed( 30 );
-			DCM_controlDCM( &ast_g_DCMs[0], DCM_U8_STOP );
-			DCM_controlDCM( &ast_g_DCMs[1], DCM_U8_STOP );
-			
-			u16_l_distance = US_readDistance();
-			
-			LCD_setCursor( 0,6 );
-			LCD_sendString( ( u8* ) "00" );
-			LCD_setCursor(0,14);
-			LCD_sendCharacter('S');
-			
-			while( u16_l_distance <= 30 )
+			/* Step 1: Exit the current State */
+			if ( Ast_gs_states[u8_gs_currentState].pf_g_exitAction != NULL )
 			{
-				DCM_controlDCMSpeed( 30 );
-				DCM_controlDCM( &ast_g_DCMs[0], DCM_U8_ROTATE_CCW );
-				DCM_controlDCM( &ast_g_DCMs[1], DCM_U8_ROTATE_CCW );
-				
-				u16_l_distance = US_readDistance();
-				
-				LCD_setCursor( 0, 6 );
-				LCD_sendString( ( u8* ) "30" );
-				LCD_setCursor( 0, 14 );
-				LCD_sendCharacter( 'B' );
-				LCD_setCursor( 1 ,7 );
-				LCD_floatToString( u16_l_distance );
-				APP_stopCar();
+				Ast_gs_states[u8_gs_currentState].pf_g_exitAction();
 			}
 			
-			if ( u8_g_select == APP_U8_CAR_ROTATE_RGT )
-			{
-				DCM_controlDCMSpeed( 30 );
-				DCM_controlDCM( &ast_g_DCMs[0], DCM_U8_ROTATE_CCW );
-				DCM_controlDCM( &ast_g_DCMs[1], DCM_U8_ROTATE_CW );
-				
-				LCD_setCursor( 0 ,6 );
-				LCD_sendString( ( u8* ) "30" );
-				LCD_setCursor( 0, 14 );
-				LCD_sendCharacter( 'R' );
-			}
+			/* Step 2: Update the current State */
+			u8_gs_currentState = Ast_gs_transitions[u8_l_index].u8_g_nextState;
+			u16_gs_stateTicks = 0;
 			
-			else
+			/* Step 3: Enter the next State */
+			if ( Ast_gs_states[u8_gs_currentState].pf_g_entryAction != NULL )
 			{
-				DCM_controlDCMSpeed( 30 );
-				DCM_controlDCM( &ast_g_DCMs[0], DCM_U8_ROTATE_CW );
-				DCM_controlDCM( &ast_g_DCMs[1], DCM_U8_ROTATE_CCW );
-				
-				LCD_setCursor( 0, 6 );
-				LCD_sendString( ( u8* ) "30" );
-				LCD_setCursor( 0, 14 );
-				LCD_sendCharacter( 'R' );
+				Ast_gs_states[u8_gs_currentState].pf_g_entryAction();
 			}
 			
-			TMR0_delayMS( 600 );
-			
-			u16_l_distance = US_readDistance();
-			
-			LCD_setCursor( 1, 7 );
-			LCD_floatToString( u16_l_distance );
+			u8_l_transitionState = STD_TYPES_OK;
 			
-			DCM_controlDCMSpeed( 30 );
-			DCM_controlDCM( &ast_g_DCMs[0], DCM_U8_STOP );
-			DCM_controlDCM( &ast_g_DCMs[1], DCM_U8_STOP );
-			
-			LCD_setCursor( 0, 6 );
-			LCD_sendString( ( u8* ) "00" );
-			LCD_setCursor( 0, 14 );
-			LCD_sendCharacter( 'S' );
-			APP_stopCar();
+			break;
 		}
-		/************************************************************************************/
-		/*****************************Forth State********************************************/
-		/************************************************************************************/
-		else if ( u16_l_distance <= 20 )
+	}
+	
+	return u8_l_transitionState;
+}
+
+/*******************************************************************************************************************************************************************/
+/*
+ Name: APP_readDistance
+ Input: void
+ Output: void
+ Description: Function to read the latest filtered auto ranging sample, without waiting for the echo.
+*/
+static void APP_readDistance   ( void )
+{
+	ST_US_Sample st_l_sample;
+	
+	US_readSample( APP_U8_US_FRONT, &st_l_sample );
+	
+	/* Check 1: Sample is too old, auto ranging stopped */
+	if ( ( SWT_getMillis() - st_l_sample.timestamp ) > APP_U16_SAMPLE_MAX_AGE_MS )
+	{
+		/* Consider obstacle is critical to stop the car */
+		u16_gs_distance = 0;
+	}
+	/* Check 2: Sample is fresh */
+	else
+	{
+		switch ( st_l_sample.status )
 		{
-			DCM_controlDCMSpeed( 30 );
-			DCM_controlDCM( &ast_g_DCMs[0], DCM_U8_STOP );
-			DCM_controlDCM( &ast_g_DCMs[1], DCM_U8_STOP );
+			case US_OK		: u16_gs_distance = st_l_sample.filteredDistance;	break;
 			
-			u16_l_distance = US_readDistance();
+			/* Nothing in range */
+			case US_NO_ECHO	: u16_gs_distance = US_MAX_DISTANCE_CM;		break;
 			
-			LCD_setCursor( 0, 6 );
-			LCD_sendString( ( u8* ) "00" );
-			LCD_setCursor( 0, 14 );
-			LCD_sendCharacter( 'S' );
-			LCD_setCursor( 1, 7 );
-			LCD_floatToString( u16_l_distance );
+			/* Sensor is not responding, consider obstacle is critical to stop the car */
+			case US_FAULT	: u16_gs_distance = 0;						break;
 			
-			u8 u8_l_counter = 0;
-			
-			while ( ( u8_l_counter < 4 ) && ( u16_l_distance <= 20 ) )
-			{
-				APP_stopCar();
-				
-				u16_l_distance = US_readDistance();
-				
-				u8_l_counter++;
-				
-				if ( u8_g_select == APP_U8_CAR_ROTATE_RGT )
-				{
-					DCM_controlDCMSpeed( 30 );
-					DCM_controlDCM( &ast_g_DCMs[0], DCM_U8_ROTATE_CCW );
-					DCM_controlDCM( &ast_g_DCMs[1], DCM_U8_ROTATE_CW );
-					
-					LCD_setCursor( 1, 0 );
-					LCD_sendString((u8*)"Speed:30% Dir:R");
-				}
-				
-				else
-				{
-					DCM_controlDCMSpeed( 30 );
-					DCM_controlDCM( &ast_g_DCMs[0], DCM_U8_ROTATE_CW );
-					DCM_controlDCM( &ast_g_DCMs[1], DCM_U8_ROTATE_CCW );
-					
-					LCD_setCursor( 1, 0 );
-					LCD_sendString( ( u8* ) "Speed:30% Dir:R" );
-				}
-				
-				TMR0_delayMS( 600 );
-			}
-			
-			if ( u8_l_counter == 4 )
-			{
-				while( u16_l_distance <= 20 )
-				{
-					DCM_controlDCMSpeed( 30 );
-					DCM_controlDCM( &ast_g_DCMs[0], DCM_U8_STOP );
-					DCM_controlDCM( &ast_g_DCMs[1], DCM_U8_STOP );
-					
-					u16_l_distance = US_readDistance();
-					
-					LCD_setCursor( 0, 6 );
-					LCD_sendString( ( u8* ) "00" );
-					LCD_setCursor( 0, 14 );
-					LCD_sendCharacter( 'S' );
-					APP_stopCar();
-				}
-			}
-			
-			APP_stopCar();
+			/* No measurement completed yet, keep last distance */
+			default			: /* Do Nothing */							break;
 		}
 	}
+	
+	APP_setDisplayDistance( u16_gs_distance );
+}
+
+/*******************************************************************************************************************************************************************/
+/*
+ Name: APP_classifyDistance
+ Input: u16 Distance and u8 CurrentZone
+ Output: u8 Distance Zone
+ Description: Function to map a distance on a zone, a nearer zone is entered once its threshold is crossed, 
+			  but a farther zone is entered only after the distance exceeds the threshold by the hysteresis band.
+*/
+static u8 APP_classifyDistance( u16 u16_a_distance, u8 u8_a_currentZone )
+{
+	u8 u8_l_nearerZone, u8_l_fartherZone;
+	u16 u16_l_distance;
+	
+	/* Step 1: Classify the distance as is, to detect a nearer zone */
+	if		( u16_a_distance > APP_U16_FAR_DISTANCE		 ) u8_l_nearerZone = APP_U8_ZONE_FAR;
+	else if ( u16_a_distance > APP_U16_NEAR_DISTANCE	 ) u8_l_nearerZone = APP_U8_ZONE_MID;
+	else if ( u16_a_distance > APP_U16_CRITICAL_DISTANCE ) u8_l_nearerZone = APP_U8_ZONE_NEAR;
+	else												   u8_l_nearerZone = APP_U8_ZONE_CRITICAL;
+	
+	/* Step 2: Classify the distance less the hysteresis band, to detect a farther zone */
+	u16_l_distance = ( u16_a_distance > APP_U16_HYSTERESIS ) ? ( u16_a_distance - APP_U16_HYSTERESIS ) : 0;
+	
+	if		( u16_l_distance > APP_U16_FAR_DISTANCE		 ) u8_l_fartherZone = APP_U8_ZONE_FAR;
+	else if ( u16_l_distance > APP_U16_NEAR_DISTANCE	 ) u8_l_fartherZone = APP_U8_ZONE_MID;
+	else if ( u16_l_distance > APP_U16_CRITICAL_DISTANCE ) u8_l_fartherZone = APP_U8_ZONE_NEAR;
+	else												   u8_l_fartherZone = APP_U8_ZONE_CRITICAL;
+	
+	/* Check 1: Distance moved to a nearer zone */
+	if ( u8_l_nearerZone > u8_a_currentZone )
+	{
+		return u8_l_nearerZone;
+	}
+	/* Check 2: Distance moved to a farther zone, beyond the hysteresis band */
+	else if ( u8_l_fartherZone < u8_a_currentZone )
+	{
+		return u8_l_fartherZone;
+	}
+	/* Check 3: Distance is still within ( or around ) the current zone */
+	else
+	{
+		return u8_a_currentZone;
+	}
 }
 
 /*******************************************************************************************************************************************************************/
 /*
- Name: APP_stopCar
+ Name: APP_keypadTask
  Input: void
  Output: void
- Description: Function to Stop the car. 
+ Description: Task to map the pressed key on an Event, Key 2 pauses the car and Key 1 resumes it.
 */
-vd APP_stopCar( void )
+void APP_keypadTask	   ( void )
 {
 	u8 u8_l_keyValue = KPD_U8_KEY_NOT_PRESSED;
 	
-	KPD_getPressedKey( &u8_l_keyValue );
+	/* Sample once, never blocks while a Key is held ( debounced over Keypad Task periods ) */
+	KPD_scanKey( &u8_l_keyValue );
 	
-	if ( u8_l_keyValue == '2' )
+	switch ( u8_l_keyValue )
+	{
+		case '1': u8_gs_keyEvent = APP_U8_EVENT_RESUME; break;
+		case '2': u8_gs_keyEvent = APP_U8_EVENT_PAUSE;	break;
+	}
+}
+
+/*******************************************************************************************************************************************************************/
+/*
+ Name: APP_motorTask
+ Input: void
+ Output: void
+ Description: Task to set the commanded motion as both DCMs targets, once it is changed, and commit them together ( DCM ramps towards them ).
+*/
+void APP_motorTask	   ( void )
+{
+	if ( u8_gs_motorUpdate )
 	{
-		DCM_controlDCMSpeed( 30 );
-		DCM_controlDCM( &ast_g_DCMs[0], DCM_U8_STOP );
-		DCM_controlDCM( &ast_g_DCMs[1], DCM_U8_STOP );
+		u8_gs_motorUpdate = 0;
 		
-		LCD_setCursor( 0, 0 );
-		LCD_sendString( ( u8* ) "Speed:00% Dir:S" );
+		DCM_setTarget( DCM_U8_RIGHT_DCM, u8_gs_rightDirection, u8_gs_rightSpeed );
+		DCM_setTarget( DCM_U8_LEFT_DCM, u8_gs_leftDirection, u8_gs_leftSpeed );
+		DCM_commitTargets();
+	}
+}
+
+/*******************************************************************************************************************************************************************/
+/*
+ Name: APP_displayTask
+ Input: void
+ Output: void
+ Description: Task to render the Display Model ( speed, direction and distance ) at the display refresh rate, once it is changed.
+*/
+void APP_displayTask   ( void )
+{
+	/* Check 1: Display Model is changed, render a new Frame */
+	if ( u8_gs_displayUpdate )
+	{
+		u8_gs_displayUpdate = 0;
 		
-		while ( u8_l_keyValue != '1' )
-		{
-			KPD_getPressedKey( &u8_l_keyValue );
-		}
-	}	
+		LCD_writeFrameCharacter( 0, 6, ( u8_gs_displaySpeed / 10 ) + '0' );
+		LCD_writeFrameCharacter( 0, 7, ( u8_gs_displaySpeed % 10 ) + '0' );
+		LCD_writeFrameCharacter( 0, 14, u8_gs_displayDirection );
+		
+		#if APP_U8_DCM_STATS_DISPLAY == 0
+		/* Distance right aligned in its 4 characters field, a shorter distance leaves no old digits */
+		LCD_writeFrameUnsigned( 1, 6, u16_gs_displayDistance, 4 );
+		#endif
+	}
+	
+	#if APP_U8_DCM_STATS_DISPLAY == 1
+	u16 u16_l_hits, u16_l_misses;
+	
+	/* DCM target commands statistics, only the changed digits are sent by the flush */
+	DCM_getCacheCounters( &u16_l_hits, &u16_l_misses );
+	LCD_writeFrameUnsigned( 1, 2, u16_l_hits, 5 );
+	LCD_writeFrameUnsigned( 1, 10, u16_l_misses, 5 );
+	#endif
+	
+	/* Send only the changed cells, also the rest of a Frame that did not fit in the LCD queue, an unchanged Frame is compared but nothing is sent */
+	u8_gs_displayBytes = LCD_flushFrame();
+	
+	if ( u8_gs_displayBytes > u8_gs_maxDisplayBytes )
+	{
+		u8_gs_maxDisplayBytes = u8_gs_displayBytes;
+	}
+}
+
+/*******************************************************************************************************************************************************************/
+/*
+ Name: APP_moveCar
+ Input: u8 Speed, u8 RightDirection, u8 LeftDirection, and u8 DirectionChar
+ Output: void
+ Description: Function to command the motion of both DCMs, it is applied by Motor Task and displayed by Display Task.
+*/
+static void APP_moveCar		   ( u8 u8_a_speed, u8 u8_a_rightDirection, u8 u8_a_leftDirection, u8 u8_a_directionChar )
+{
+	u8_gs_rightSpeed = u8_a_speed;
+	u8_gs_leftSpeed = u8_a_speed;
+	u8_gs_rightDirection = u8_a_rightDirection;
+	u8_gs_leftDirection = u8_a_leftDirection;
+	
+	u8_gs_motorUpdate = 1;
+	
+	/* Stopped car displays 00 speed */
+	if ( !DCM_IS_ROTATING( u8_a_rightDirection ) && !DCM_IS_ROTATING( u8_a_leftDirection ) )
+	{
+		u8_a_speed = 0;
+	}
+	
+	APP_setDisplayMotion( u8_a_speed, u8_a_directionChar );
+}
+
+/*******************************************************************************************************************************************************************/
+/*
+ Name: APP_arcCar
+ Input: u8 RightSpeed, u8 LeftSpeed, and u8 DirectionChar
+ Output: void
+ Description: Function to command both DCMs forward at different speeds, the car arcs towards the slower wheel without stopping.
+*/
+static void APP_arcCar		   ( u8 u8_a_rightSpeed, u8 u8_a_leftSpeed, u8 u8_a_directionChar )
+{
+	u8_gs_rightSpeed = u8_a_rightSpeed;
+	u8_gs_leftSpeed = u8_a_leftSpeed;
+	u8_gs_rightDirection = DCM_U8_ROTATE_CW;
+	u8_gs_leftDirection = DCM_U8_ROTATE_CW;
+	
+	u8_gs_motorUpdate = 1;
+	
+	APP_setDisplayMotion( ( u8_a_rightSpeed > u8_a_leftSpeed ) ? u8_a_rightSpeed : u8_a_leftSpeed, u8_a_directionChar );
+}
+
+/*******************************************************************************************************************************************************************/
+/*
+ Name: APP_setDisplayMotion
+ Input: u8 Speed and u8 DirectionChar
+ Output: void
+ Description: Function to update the displayed speed and direction in the Display Model, Display Task renders them once changed.
+*/
+static void APP_setDisplayMotion   ( u8 u8_a_speed, u8 u8_a_directionChar )
+{
+	if ( u8_gs_displaySpeed != u8_a_speed || u8_gs_displayDirection != u8_a_directionChar )
+	{
+		u8_gs_displaySpeed = u8_a_speed;
+		u8_gs_displayDirection = u8_a_directionChar;
+		u8_gs_displayUpdate = 1;
+	}
+}
+
+/*******************************************************************************************************************************************************************/
+/*
+ Name: APP_setDisplayDistance
+ Input: u16 Distance
+ Output: void
+ Description: Function to update the displayed distance in the Display Model, only once it moves by APP_U16_DISPLAY_DISTANCE_STEP_CM or more from the displayed one.
+*/
+static void APP_setDisplayDistance ( u16 u16_a_distance )
+{
+	u16 u16_l_change = ( u16_a_distance > u16_gs_displayDistance ) ? ( u16_a_distance - u16_gs_displayDistance ) : ( u16_gs_displayDistance - u16_a_distance );
+	
+	if ( u16_l_change >= APP_U16_DISPLAY_DISTANCE_STEP_CM )
+	{
+		u16_gs_displayDistance = u16_a_distance;
+		u8_gs_displayUpdate = 1;
+	}
+}
+
+#if APP_U8_LCD_BENCHMARK == 1
+/*******************************************************************************************************************************************************************/
+/*
+ Name: APP_benchmarkLCD
+ Input: void
+ Output: void
+ Description: Function to measure and display the LCD throughput, in characters per second ( whole DDRAM is written, one character at a time ).
+*/
+static void APP_benchmarkLCD   ( void )
+{
+	u32 u32_l_startTime, u32_l_elapsedTime;
+	
+	LCD_setCursor( 0, 0 );
+	
+	u32_l_startTime = SWT_getMicros();
+	
+	for ( u8 u8_l_index = 0; u8_l_index < APP_U8_LCD_BENCHMARK_CHARS; u8_l_index++ )
+	{
+		LCD_sendCharacter( ( u8_l_index % 10 ) + '0' );
+	}
+	
+	u32_l_elapsedTime = SWT_getMicros() - u32_l_startTime;
+	
+	/* Throughput in 0.1 k characters per second, integer math only */
+	u32_l_elapsedTime = ( APP_U8_LCD_BENCHMARK_CHARS * 10000UL ) / ( ( u32_l_elapsedTime != 0 ) ? u32_l_elapsedTime : 1 );
+	
+	LCD_clear();
+	LCD_sendString( ( u8* ) "kChars/s:" );
+	LCD_sendFixedPoint( APP_BENCHMARK_CLAMP_U16( u32_l_elapsedTime ), 1 );
+	
+	SWT_delayMS( APP_U16_START_DELAY_MS );
+	
+	/* Number formatting time ( us ) of the float routine against the fixed point routine, Frame writes only ( no LCD bus ) */
+	u32_l_startTime = SWT_getMicros();
+	
+	for ( u8 u8_l_index = 0; u8_l_index < APP_U8_LCD_BENCHMARK_CHARS; u8_l_index++ )
+	{
+		LCD_writeFrameFloat( 0, 0, 400 - u8_l_index );
+	}
+	
+	u32_l_elapsedTime = SWT_getMicros() - u32_l_startTime;
+	
+	LCD_clear();
+	LCD_sendString( ( u8* ) "Float us:" );
+	LCD_sendUnsigned( APP_BENCHMARK_CLAMP_U16( u32_l_elapsedTime ) );
+	
+	u32_l_startTime = SWT_getMicros();
+	
+	for ( u8 u8_l_index = 0; u8_l_index < APP_U8_LCD_BENCHMARK_CHARS; u8_l_index++ )
+	{
+		LCD_writeFrameFixedPoint( 0, 0, 4000 - u8_l_index, 1, 0 );
+	}
+	
+	u32_l_elapsedTime = SWT_getMicros() - u32_l_startTime;
+	
+	LCD_setCursor( 1, 0 );
+	LCD_sendString( ( u8* ) "Fixed us:" );
+	LCD_sendUnsigned( APP_BENCHMARK_CLAMP_U16( u32_l_elapsedTime ) );
+	
+	SWT_delayMS( APP_U16_START_DELAY_MS );
+	LCD_clearFrame();
+	LCD_clear();
+}
+
+#endif
+#if PWM_U8_TIMING_BENCHMARK == 1
+/*******************************************************************************************************************************************************************/
+/*
+ Name: APP_benchmarkPWM
+ Input: void
+ Output: void
+ Description: Function to measure and display the time ( us ) of computing the PWM On/Off timings of all DutyCycles, with the former float math
+			  and with the flash table lookup.
+*/
+static void APP_benchmarkPWM   ( void )
+{
+	u32 u32_l_startTime, u32_l_elapsedTime;
+	
+	u32_l_startTime = SWT_getMicros();
+	
+	PWM_benchmarkTiming( PWM_U8_TIMING_FLOAT );
+	
+	u32_l_elapsedTime = SWT_getMicros() - u32_l_startTime;
+	
+	LCD_clear();
+	LCD_sendString( ( u8* ) "Float us:" );
+	LCD_sendUnsigned( APP_BENCHMARK_CLAMP_U16( u32_l_elapsedTime ) );
+	
+	u32_l_startTime = SWT_getMicros();
+	
+	PWM_benchmarkTiming( PWM_U8_TIMING_TABLE );
+	
+	u32_l_elapsedTime = SWT_getMicros() - u32_l_startTime;
+	
+	LCD_setCursor( 1, 0 );
+	LCD_sendString( ( u8* ) "Table us:" );
+	LCD_sendUnsigned( APP_BENCHMARK_CLAMP_U16( u32_l_elapsedTime ) );
+	
+	SWT_delayMS( APP_U16_START_DELAY_MS );
+	LCD_clear();
+}
+
+#endif
+#if PWM_U8_ISR_LOAD_MEASURE == 1
+/*******************************************************************************************************************************************************************/
+/*
+ Name: APP_measurePWMLoad
+ Input: void
+ Output: void
+ Description: Function to measure and display the Software PWM ISR CPU cycles per period and CPU load ( in 0.01% ) over APP_U16_START_DELAY_MS,
+			  at PWM_U16_SOFTWARE_FREQUENCY_HZ ( the ISR run time does not depend on the DutyCycle ).
+*/
+static void APP_measurePWMLoad ( void )
+{
+	u32 u32_l_ISRCycles;
+	u16 u16_l_periods;
+	
+	/* Step 1: Start TMR2 if it is not running yet, DCMs are stopped, so 0% duty does not move them */
+	PWM_generatePWM( 0 );
+	
+	/* Step 2: Restart counting, then wait for the measurement window */
+	PWM_getISRLoad( &u32_l_ISRCycles, &u16_l_periods );
+	SWT_delayMS( APP_U16_START_DELAY_MS );
+	PWM_getISRLoad( &u32_l_ISRCycles, &u16_l_periods );
+	
+	if ( u16_l_periods == 0 ) u16_l_periods = 1;
+	
+	/* Step 3: ISR cycles per period, in 0.1 cycle */
+	u32_l_ISRCycles = ( u32_l_ISRCycles * 10 ) / u16_l_periods;
+	
+	LCD_clear();
+	LCD_sendString( ( u8* ) "ISR cyc/T:" );
+	LCD_sendFixedPoint( APP_BENCHMARK_CLAMP_U16( u32_l_ISRCycles ), 1 );
+	
+	/* Step 4: CPU load = ISR cycles per period / period cycles ( F_CPU / Frequency ), in 0.01% */
+	u32_l_ISRCycles = ( u32_l_ISRCycles * PWM_U16_SOFTWARE_FREQUENCY_HZ ) / ( F_CPU / 1000UL );
+	
+	LCD_setCursor( 1, 0 );
+	LCD_sendString( ( u8* ) "Load %:" );
+	LCD_sendFixedPoint( APP_BENCHMARK_CLAMP_U16( u32_l_ISRCycles ), 2 );
+	
+	SWT_delayMS( APP_U16_START_DELAY_MS );
+	LCD_clear();
+}
+
+#endif
+/*******************************************************************************************************************************************************************/
+/* APP States' Actions */
+
+/* Stop, and Fourth States: Stop the car, brake then coast to stand still within a shorter distance */
+static void APP_enterStop	   ( void )
+{
+	APP_moveCar( APP_U8_SLOW_SPEED, DCM_U8_BRAKE_THEN_COAST, DCM_U8_BRAKE_THEN_COAST, 'S' );
+}
+
+/* Stop State: Obstacle is still critical after max. turns, wait for its removal ( Fourth State ) */
+static u8   APP_tickStop	   ( void )
+{
+	if ( ( u8_gs_distanceZone == APP_U8_ZONE_CRITICAL ) && ( u8_gs_turnsCounter >= APP_U8_MAX_TURNS ) )
+	{
+		return APP_U8_EVENT_BLOCKED;
+	}
+	
+	return APP_U8_EVENT_NONE;
+}
+
+/* First State: Move forward slowly, the road is clear ( restart turns ) */
+static void APP_enterFirstSlow ( void )
+{
+	u8_gs_turnsCounter = 0;
+	
+	APP_moveCar( APP_U8_SLOW_SPEED, DCM_U8_ROTATE_CW, DCM_U8_ROTATE_CW, 'F' );
+}
+
+/* First State: Speed up after 5 sec. of clear road */
+static u8   APP_tickFirstSlow  ( void )
+{
+	return ( u16_gs_stateTicks >= APP_U16_SLOW_CRUISE_TICKS ) ? APP_U8_EVENT_TIMEOUT : APP_U8_EVENT_NONE;
+}
+
+/* First State: Move forward fast */
+static void APP_enterFirstFast ( void )
+{
+	APP_moveCar( APP_U8_FAST_SPEED, DCM_U8_ROTATE_CW, DCM_U8_ROTATE_CW, 'F' );
+}
+
+/* Second State: Move forward slowly, arcing away in the default rotation ( restart turns ) */
+static void APP_enterSecond	   ( void )
+{
+	u8_gs_turnsCounter = 0;
+	
+	if ( u8_g_select == APP_U8_CAR_ROTATE_RGT )
+	{
+		APP_arcCar( APP_U8_ARC_INNER_SPEED, APP_U8_SLOW_SPEED, 'F' );
+	}
+	else
+	{
+		APP_arcCar( APP_U8_SLOW_SPEED, APP_U8_ARC_INNER_SPEED, 'F' );
+	}
+}
+
+/* Third State: Move backward until the obstacle is beyond 30 cm ( restart turns ) */
+static void APP_enterThird	   ( void )
+{
+	u8_gs_turnsCounter = 0;
+	
+	APP_moveCar( APP_U8_SLOW_SPEED, DCM_U8_ROTATE_CCW, DCM_U8_ROTATE_CCW, 'B' );
+}
+
+/* Turn State: Rotate in the default rotation */
+static void APP_enterTurn	   ( void )
+{
+	u8_gs_turnsCounter++;
+	
+	if ( u8_g_select == APP_U8_CAR_ROTATE_RGT )
+	{
+		APP_moveCar( APP_U8_SLOW_SPEED, DCM_U8_ROTATE_CCW, DCM_U8_ROTATE_CW, 'R' );
+	}
+	else
+	{
+		APP_moveCar( APP_U8_SLOW_SPEED, DCM_U8_ROTATE_CW, DCM_U8_ROTATE_CCW, 'R' );
+	}
+}
+
+/* Turn State: Stop rotating after 600 ms */
+static u8   APP_tickTurn	   ( void )
+{
+	return ( u16_gs_stateTicks >= APP_U16_TURN_TICKS ) ? APP_U8_EVENT_TIMEOUT : APP_U8_EVENT_NONE;
+}
+
+/* Fourth State: Obstacle is removed ( restart turns ) */
+static void APP_exitFourth	   ( void )
+{
+	u8_gs_turnsCounter = 0;
+}
+
+/* Pause State: Stop the car until resumed, brake then coast */
+static void APP_enterPause	   ( void )
+{
+	APP_moveCar( APP_U8_SLOW_SPEED, DCM_U8_BRAKE_THEN_COAST, DCM_U8_BRAKE_THEN_COAST, 'S' );
+}
+
+/* Pause State: Resume with a fresh turns count */
+static void APP_exitPause	   ( void )
+{
+	u8_gs_turnsCounter = 0;
 }
 
 /*******************************************************************************************************************************************************************/
\ No newline at end of file
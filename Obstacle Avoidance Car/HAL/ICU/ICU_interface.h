@@ -31,7 +31,7 @@ typedef enum
 }EN_ICU_EdgeType;
 
 typedef enum{
-	EN_INT0,EN_INT1,EN_INT2,MAX_INT
+	EN_INT0,EN_INT1,EN_INT2,EN_ICP1,MAX_INT		//EN_ICP1: timer1 hardware input capture on PD6 (pin must be input)
 }EN_ICU_Source;
 
 typedef enum{
@@ -48,38 +48,39 @@ typedef struct
 /*============= FUNCTION PROTOTYPE =============*/
 
 /*
- * Description : Function to initialize the ICU driver
- * 	1. Set the required clock.
+ * Description : Function to initialize one ICU channel, channels can be initialized and used at the same time
+ * 	1. Set the required clock, timer1 is started free running by the first channel (or the system tick) and shared by all channels.
  * 	2. Set the required edge detection.
- * 	3. Enable the External Interrupt source and edge.
- * 	4. Initialize Timer1 Registers
+ * 	3. Enable the External Interrupt source and edge, or Timer1 input capture interrupt with noise canceler for EN_ICP1.
+ * 	return invalid if channel is already used, or clock differs from the running timebase
  */
 EN_state ICU_init(const ST_ICU_ConfigType * Config_Ptr);
 
 /*
- * Description: Function to set the Call Back function address.
+ * Description: Function to set the Call Back function address of a channel, called from ISR after each captured edge.
  */
-EN_state ICU_setCallBack(void(*a_ptr)(void));
+EN_state ICU_setCallBack(EN_ICU_Source source,void(*a_ptr)(void));
 
 /*
- * Description: Function to set the required edge detection.
+ * Description: Function to set the required edge detection of a channel.
  */
-EN_state ICU_setEdgeDetectionType(const EN_ICU_EdgeType edgeType);
+EN_state ICU_setEdgeDetectionType(EN_ICU_Source source,const EN_ICU_EdgeType edgeType);
 
 /*
- * Description: Function to get the Timer1 Value when the external interrupt is capture edge
- *             
+ * Description: Function to get the Timer1 Value of the last captured edge of a channel
+ *              EN_ICP1: value latched by hardware in ICR1, external interrupts: TCNT1 read in the ISR (includes ISR latency)
  */
-u16 ICU_getInputCaptureValue(void);
+u16 ICU_getInputCaptureValue(EN_ICU_Source source);
 
 /*
- * Description: Function to clear the Timer1 Value to start count from ZERO
+ * Description: Function to get the time (timer counts) between the last rising and the following falling edge of a channel
+ *              wrap safe for pulses shorter than one timer1 period (65536 counts), to be called from the channel call back
  */
-void ICU_clearTimerValue(void);
+u16 ICU_getHighTime(EN_ICU_Source source);
 
 /*
- * Description: Function to disable the Timer1 and External interrupt to stop the ICU Driver
+ * Description: Function to disable one channel, Timer1 is stopped when no channel is used
  */
-void ICU_DeInit(void);
+void ICU_DeInit(EN_ICU_Source source);
 
 #endif /* ICU_INTERFACE_H_ */
\ No newline at end of file
@@ -14,34 +14,46 @@
 /*******************************************************************************************************************************************************************/
 /* DCM Configurations */
 
-/* DCM Speed (PWM) Port */
-/* Options: A:0
-			B:1
-			C:2
-			D:3
-*/
-#define DCM_U8_PWM_PORT				D
-
-/* DCM Speed (PWM) Pin */
-/* Options: P0
-			P1
-			P2
-			P3
-			P4
-			P5
-			P6
-			P7
- */
-#define DCM_U8_PWM_PIN				P4
+/* DCM Speed (PWM) Port and Pin are configured per DCM, in DCM_ST_CONFIG */
+/* Note: PWM Hardware Backend drives OC0 ( Port B/P3 ) and OC2 ( Port D/P7 ) only, one per DCM for independent wheel speeds,
+		 both DCM(s) may use the same Pin to share one speed */
  
-/* Number of DCM(s) */
+/* Number of DCM(s), each with its own Direction Pins, Speed Pin, Polarity and Trim in DCM_ST_CONFIG */
 #define DCM_U8_NUMBER_OF_DCM		2
 
+/* Max. Number of Ports used by all DCM(s) Direction Pins ( A, B, C, D ) */
+#define DCM_U8_MAX_PORTS			4
+
 /* DCM Max Speed */
 #define DCM_U8_MAX_SPEED			100
 
-/* DCM Frequency is 200 Hz ( i.e. 0.2 KHz )  */
-#define DCM_U8_FREQUENCY			0.2f
+/* DCM Ramp Period ( in ms ), the Ramp is stepped from the system tick ISR every period */
+#define DCM_U8_RAMP_PERIOD_MS		10
+
+/* DCM Ramp Acceleration and Deceleration limits ( Speed Percentage per Ramp Period ), i.e. 0 to 50% in 250 ms and 50% to 0 in 125 ms */
+#define DCM_U8_ACCELERATION_STEP	2
+#define DCM_U8_DECELERATION_STEP	4
+
+/* DCM Ramp Dwell at zero speed before a direction reversal ( in Ramp Periods ), i.e. 100 ms */
+#define DCM_U8_REVERSE_DWELL		10
+
+/* DCM Brake Speed ( Speed Percentage on the Speed Pin while braking ), the Motor Driver shorts the DCM only while its Enable (PWM) is ON */
+#define DCM_U8_BRAKE_SPEED			100
+
+/* DCM Brake Time of DCM_U8_BRAKE_THEN_COAST ( in Ramp Periods ), i.e. 200 ms, then the DCM coasts */
+#define DCM_U8_BRAKE_TIME			20
+
+/* DCM Frequency ( in Hz ) */
+/* Options: PWM Hardware Backend, exact on both TMR0 and TMR2 at 8 MHz, so both wheels run at the same frequency:
+			31250 : inaudible, no visible torque ripple ( the Motor Driver must switch at 31 KHz )
+			3906
+			488
+			PWM Software Backend: PWM_U16_SOFTWARE_FREQUENCY_HZ only
+ */
+#define DCM_U16_FREQUENCY_HZ		31250
+
+/* DCM Frequency in KHz, as expected by PWM_initialization */
+#define DCM_U8_FREQUENCY			( DCM_U16_FREQUENCY_HZ / 1000.0f )
 
 /* End of Configurations */
 
@@ -17,6 +17,7 @@
 /* LIB */
 #include "../../LIB/std_types/std_types.h"
 #include "../../LIB/bit_math/bit_math.h"
+#include "../../LIB/swt/swt_interface.h"
 
 /* MCAL */
 #include "../../MCAL/dio/dio_interface.h"
@@ -31,20 +32,45 @@ typedef struct
 	u8 u8_g_directionCWPort;
 	u8 u8_g_directionCWPin;
 	u8 u8_g_directionCCWPort;
-	u8 u8_g_directionCCWPin;	
+	u8 u8_g_directionCCWPin;
+	u8 u8_g_speedPort;
+	u8 u8_g_speedPin;
+	u8 u8_g_polarity;		/* DCM_U8_POLARITY_NORMAL or DCM_U8_POLARITY_INVERTED ( CW and CCW Pins swapped, for a mirrored DCM ) */
+	u8 u8_g_trim;			/* Percentage of the commanded speed applied on the Speed Pin, 0 to DCM_U8_MAX_TRIM, to match DCM(s) speeds */
 } DCM_ST_CONFIG;
 
+/* DCM Polarities */
+#define DCM_U8_POLARITY_NORMAL		0
+#define DCM_U8_POLARITY_INVERTED	1
+
+/* DCM Max. Trim, no trim */
+#define DCM_U8_MAX_TRIM				100
+
+/* Right and Left DCM(s) indexes in DCM_ST_CONFIG array */
+#define DCM_U8_RIGHT_DCM		0
+#define DCM_U8_LEFT_DCM			1
+
 /* DCM Control Modes */
-#define DCM_U8_STOP				0
+#define DCM_U8_STOP				0	/* Coast: both Direction Pins LOW */
 #define DCM_U8_ROTATE_CW		1
 #define DCM_U8_ROTATE_CCW		2
+#define DCM_U8_BRAKE			3	/* Short Brake: both Direction Pins HIGH, held ( the Speed Pin must be ON to brake ) */
+#define DCM_U8_BRAKE_THEN_COAST	4	/* Short Brake for DCM_U8_BRAKE_TIME Ramp Periods, then Coast */
+
+/* DCM Control Mode is a rotation */
+#define DCM_IS_ROTATING( MODE )	( ( ( MODE ) == DCM_U8_ROTATE_CW ) || ( ( MODE ) == DCM_U8_ROTATE_CCW ) )
 
 /*******************************************************************************************************************************************************************/
 /* DCM Functions' Prototypes */
 
 u8 DCM_initialization ( DCM_ST_CONFIG *pst_a_DCMConfig );
 u8 DCM_controlDCM     ( DCM_ST_CONFIG *pst_a_DCMConfig, u8 u8_a_controlMode );
+u8 DCM_controlAll     ( const u8 *pu8_a_controlModes );
 u8 DCM_controlDCMSpeed( u8 u8_a_speedPercentage );
+u8 DCM_setWheelSpeeds ( u8 u8_a_leftSpeedPercentage, u8 u8_a_rightSpeedPercentage );
+u8 DCM_getCacheCounters( u16 *pu16_a_returnedHits, u16 *pu16_a_returnedMisses );
+u8 DCM_setTarget      ( u8 u8_a_DCMIndex, u8 u8_a_controlMode, u8 u8_a_speedPercentage );
+void DCM_commitTargets( void );
 
 /*******************************************************************************************************************************************************************/
 
@@ -8,44 +8,231 @@
  *    Model No.: RF-300CA-11440 - DCM
  */
 
+/* MCAL */
+#include "../../MCAL/pwm/pwm_config.h"
+#include "../../MCAL/gli/gli_interface.h"
+
 /* HAL */
 #include "dcm_config.h"
 #include "dcm_interface.h"
 
+#if DCM_U8_BRAKE_SPEED > DCM_U8_MAX_SPEED
+#error "DCM: DCM_U8_BRAKE_SPEED must not exceed DCM_U8_MAX_SPEED"
+#endif
+
+#if ( PWM_U8_BACKEND == PWM_U8_BACKEND_HARDWARE ) && ( DCM_U16_FREQUENCY_HZ > PWM_U32_MAX_FREQUENCY_HZ )
+#error "DCM: DCM_U16_FREQUENCY_HZ is above the Fast PWM max. frequency ( F_CPU / 256 )"
+#elif ( PWM_U8_BACKEND == PWM_U8_BACKEND_HARDWARE ) && !PWM_IS_EXACT_FREQUENCY_HZ( DCM_U16_FREQUENCY_HZ )
+#warning "DCM: DCM_U16_FREQUENCY_HZ is not an exact Fast PWM frequency on both TMR0 and TMR2, the nearest one is used"
+#elif ( PWM_U8_BACKEND == PWM_U8_BACKEND_SOFTWARE ) && ( DCM_U16_FREQUENCY_HZ != PWM_U16_SOFTWARE_FREQUENCY_HZ )
+#error "DCM: DCM_U16_FREQUENCY_HZ must be PWM_U16_SOFTWARE_FREQUENCY_HZ with the PWM Software Backend"
+#endif
+
+/*******************************************************************************************************************************************************************/
+/* Declaration and Initialization */
+
+/* Global Pointer to the DCM(s) Configurations, stored by DCM_initialization */
+static DCM_ST_CONFIG *pst_gs_DCMConfig = NULL;
+
+/* DCM Direction Port: one Port touched by the Direction Pins, and the mask of all Direction Pins on it */
+typedef struct
+{
+	u8 u8_g_port;
+	u8 u8_g_mask;
+} DCM_ST_PORT;
+
+/* DCM Direction Pins: index in the Direction Ports array and mask of the Pin driven HIGH to rotate CW and CCW ( swapped by an inverted polarity ) */
+typedef struct
+{
+	u8 u8_g_CWPortIndex;
+	u8 u8_g_CWMask;
+	u8 u8_g_CCWPortIndex;
+	u8 u8_g_CCWMask;
+} DCM_ST_PINS;
+
+/* Global Arrays of the Direction Ports and DCM(s) Direction Pins, built by DCM_initialization, a DCM(s) direction update writes each touched Port once */
+static DCM_ST_PORT ast_gs_directionPorts[DCM_U8_MAX_PORTS];
+static u8 u8_gs_numberOfPorts = 0;
+static DCM_ST_PINS ast_gs_directionPins[DCM_U8_NUMBER_OF_DCM];
+
+/* Global Arrays of the last Direction and Speed applied on each DCM, a Ramp step or command matching them skips the DIO/PWM write */
+static u8 au8_gs_appliedModes[DCM_U8_NUMBER_OF_DCM];
+static u8 au8_gs_appliedSpeeds[DCM_U8_NUMBER_OF_DCM];
+
+/* Global Counters of DCM_setTarget commands that repeated the pending target ( hits ) or changed it ( misses ), wrap around at 65535 ( main context only ) */
+static u16 u16_gs_cacheHits = 0;
+static u16 u16_gs_cacheMisses = 0;
+
+/* Global Flag, set by DCM_setTarget on a changed target, DCM_commitTargets is skipped without a change */
+static u8 u8_gs_targetsChanged = 0;
+
+/* DCM Ramp State */
+typedef struct
+{
+	volatile u8 u8_g_pendingMode;		/* Set by DCM_setTarget */
+	volatile u8 u8_g_pendingSpeed;		/* Set by DCM_setTarget */
+	u8 u8_g_targetMode;					/* Pending Mode, taken by the Ramp once committed */
+	u8 u8_g_targetSpeed;				/* Pending Speed, taken by the Ramp once committed */
+	u8 u8_g_currentMode;				/* Applied on the Direction Pins */
+	u8 u8_g_currentSpeed;				/* Applied on the Speed Pin */
+	u8 u8_g_dwell;						/* Remaining Ramp Periods at zero speed before reversal */
+	u8 u8_g_brakeTime;					/* Remaining Ramp Periods of Brake before Coast, 0: Brake is held */
+} DCM_ST_RAMP;
+
+/* Global Array of DCM(s) Ramp States, stepped by the Ramp Timer ( tick ISR ) */
+static DCM_ST_RAMP ast_gs_ramps[DCM_U8_NUMBER_OF_DCM];
+
+/* Global Flag, set by DCM_commitTargets, the next Ramp step takes the pending targets of all DCM(s) together */
+static volatile u8 u8_gs_commitTargets = 0;
+
+/*******************************************************************************************************************************************************************/
+/* DCM Private Functions' Prototypes */
+
+static void DCM_stepRamp( void );
+static u8   DCM_getIndex( DCM_ST_CONFIG *pst_a_DCMConfig );
+static void DCM_writeDirection( DCM_ST_CONFIG *pst_a_DCMConfig, u8 u8_a_controlMode );
+static void DCM_writePorts( u8 u8_a_portsMask );
+static u8   DCM_setAppliedMode( u8 u8_a_DCMIndex, u8 u8_a_controlMode );
+static u8   DCM_holdMode( u8 u8_a_DCMIndex, u8 u8_a_controlMode );
+static u8   DCM_holdSpeed( u8 u8_a_DCMIndex, u8 u8_a_speedPercentage );
+static u8   DCM_addPort( u8 u8_a_port, u8 u8_a_pin );
+static u8   DCM_applySpeed( u8 u8_a_DCMIndex, u8 u8_a_speedPercentage );
+
 /*******************************************************************************************************************************************************************/
 /*
  Name: DCM_initialization
  Input: Pointer to st DCMConfig
  Output: u8 Error or No Error
- Description: Function to Initialize DCM peripheral.
+ Description: Function to Initialize DCM peripheral, DCM_U8_NUMBER_OF_DCM DCM(s) are configured in DCMConfig array.
 */
 u8 DCM_initialization ( DCM_ST_CONFIG *pst_a_DCMConfig )
 {
 	/* Define local variable to set the error state = OK */
 	u8 u8_l_errorState = STD_TYPES_OK;
+	u8 u8_l_timerId;
+	u8 u8_l_index;
+	DCM_ST_PINS st_l_pins;
 
 	/* Check 1: Pointer is not equal to NULL */
 	if ( pst_a_DCMConfig != NULL )	
 	{
+		/* Step 1: Check Polarity and Trim of all DCM(s) */
+		for ( u8_l_index = 0; u8_l_index < DCM_U8_NUMBER_OF_DCM; u8_l_index++ )
+		{
+			if ( ( pst_a_DCMConfig[u8_l_index].u8_g_polarity > DCM_U8_POLARITY_INVERTED ) || ( pst_a_DCMConfig[u8_l_index].u8_g_trim > DCM_U8_MAX_TRIM ) )
+			{
+				/* Update error state = NOK, wrong Polarity or Trim! */
+				u8_l_errorState = STD_TYPES_NOK;
+			}
+		}
+	}
+	/* Check 2: Pointer is equal to NULL */
+	else
+	{
+		/* Update error state = NOK, Pointer is NULL! */
+		u8_l_errorState = STD_TYPES_NOK;
+	}
+	
+	/* Check 3: DCM(s) Configurations are valid */
+	if ( u8_l_errorState == STD_TYPES_OK )
+	{
+		u8_gs_numberOfPorts = 0;
+		
 		/* Loop: Until the number of configured DCM(s) is initialized */
-		for ( u8 u8_l_index = 0; u8_l_index < DCM_U8_NUMBER_OF_DCM; u8_l_index++ )
+		for ( u8_l_index = 0; u8_l_index < DCM_U8_NUMBER_OF_DCM; u8_l_index++ )
 		{
-			/* Step 1: Initialize initial direction of DCM, in both Direction Pins */
+			/* Step 2: Initialize initial direction of DCM, in both Direction Pins */
 			DIO_init( pst_a_DCMConfig[u8_l_index].u8_g_directionCWPort, pst_a_DCMConfig[u8_l_index].u8_g_directionCWPin, OUT );
 			DIO_init( pst_a_DCMConfig[u8_l_index].u8_g_directionCCWPort, pst_a_DCMConfig[u8_l_index].u8_g_directionCCWPin, OUT );
 		
-			/* Step 2: Initialize initial value of DCM, in both Direction Pins */
+			/* Step 3: Initialize initial value of DCM, in both Direction Pins */
 			DIO_write( pst_a_DCMConfig[u8_l_index].u8_g_directionCWPort, pst_a_DCMConfig[u8_l_index].u8_g_directionCWPin, LOW );
-			DIO_write( pst_a_DCMConfig[u8_l_index].u8_g_directionCCWPort, pst_a_DCMConfig[u8_l_index].u8_g_directionCCWPin, LOW );		
+			DIO_write( pst_a_DCMConfig[u8_l_index].u8_g_directionCCWPort, pst_a_DCMConfig[u8_l_index].u8_g_directionCCWPin, LOW );
+			
+			/* Step 4: Initialize PWM of DCM Speed Pin */
+			PWM_initialization( pst_a_DCMConfig[u8_l_index].u8_g_speedPort, pst_a_DCMConfig[u8_l_index].u8_g_speedPin, DCM_U8_FREQUENCY );
+			
+			/* Step 5: Add both Direction Pins to their Ports, an inverted DCM rotates CW on its CCW Pin */
+			ast_gs_directionPins[u8_l_index].u8_g_CWPortIndex = DCM_addPort( pst_a_DCMConfig[u8_l_index].u8_g_directionCWPort, pst_a_DCMConfig[u8_l_index].u8_g_directionCWPin );
+			ast_gs_directionPins[u8_l_index].u8_g_CWMask = 1 << pst_a_DCMConfig[u8_l_index].u8_g_directionCWPin;
+			ast_gs_directionPins[u8_l_index].u8_g_CCWPortIndex = DCM_addPort( pst_a_DCMConfig[u8_l_index].u8_g_directionCCWPort, pst_a_DCMConfig[u8_l_index].u8_g_directionCCWPin );
+			ast_gs_directionPins[u8_l_index].u8_g_CCWMask = 1 << pst_a_DCMConfig[u8_l_index].u8_g_directionCCWPin;
+			
+			if ( pst_a_DCMConfig[u8_l_index].u8_g_polarity == DCM_U8_POLARITY_INVERTED )
+			{
+				st_l_pins = ast_gs_directionPins[u8_l_index];
+				ast_gs_directionPins[u8_l_index].u8_g_CWPortIndex = st_l_pins.u8_g_CCWPortIndex;
+				ast_gs_directionPins[u8_l_index].u8_g_CWMask = st_l_pins.u8_g_CCWMask;
+				ast_gs_directionPins[u8_l_index].u8_g_CCWPortIndex = st_l_pins.u8_g_CWPortIndex;
+				ast_gs_directionPins[u8_l_index].u8_g_CCWMask = st_l_pins.u8_g_CWMask;
+			}
+			
+			/* Step 6: DCM is stopped at 0% speed */
+			au8_gs_appliedModes[u8_l_index] = DCM_U8_STOP;
+			au8_gs_appliedSpeeds[u8_l_index] = 0;
 		}
 		
-		/* Step 3: Initialize PWM */
-		PWM_initialization( DCM_U8_PWM_PORT, DCM_U8_PWM_PIN, DCM_U8_FREQUENCY );
+		u16_gs_cacheHits = 0;
+		u16_gs_cacheMisses = 0;
+		u8_gs_targetsChanged = 0;
+		
+		/* Step 7: Store DCM(s) Configurations, used by DCM_setWheelSpeeds and the Ramp */
+		pst_gs_DCMConfig = pst_a_DCMConfig;
+		
+		/* Step 8: Start the Ramp Timer ( SWT must be initialized ), all DCM(s) are stopped */
+		if ( SWT_createTimer( &u8_l_timerId ) == STD_TYPES_OK )
+		{
+			SWT_startTimer( u8_l_timerId, DCM_U8_RAMP_PERIOD_MS, SWT_U8_MODE_PERIODIC, DCM_stepRamp );
+		}
+		else
+		{
+			/* Update error state = NOK, no free Timer for the Ramp! */
+			u8_l_errorState = STD_TYPES_NOK;
+		}
 	}
-	/* Check 2: Pointer is equal to NULL */
+	
+	return u8_l_errorState;
+}
+
+/*******************************************************************************************************************************************************************/
+/*
+ Name: DCM_controlDCM
+ Input: Pointer to st DCMConfig and u8 ControlMode
+ Output: u8 Error or No Error
+ Description: Function Control DCM with one of DCM Modes at once ( no Ramp ), an initialized DCM takes it as its Ramp target, so the Ramp holds it.
+*/
+u8 DCM_controlDCM     ( DCM_ST_CONFIG *pst_a_DCMConfig, u8 u8_a_controlMode )
+{
+	/* Define local variable to set the error state = OK */
+	u8 u8_l_errorState = STD_TYPES_OK;
+	u8 u8_l_index, u8_l_statusRegister;
+
+	u8_l_index = DCM_getIndex( pst_a_DCMConfig );
+
+	/* Check 1: Pointer is not equal to NULL and ControlMode is in the valid range ( a timed Brake needs an initialized DCM ) */
+	if ( ( pst_a_DCMConfig != NULL ) && ( ( u8_a_controlMode <= DCM_U8_BRAKE ) ||
+		 ( ( u8_a_controlMode == DCM_U8_BRAKE_THEN_COAST ) && ( u8_l_index < DCM_U8_NUMBER_OF_DCM ) ) ) )
+	{
+		/* Step 1: Hold off the Ramp ( tick ISR ), it shares the Ramp States, the applied Modes and the Direction Ports */
+		u8_l_statusRegister = GLI_saveAndDisableGIE();
+		
+		/* Check 1.1: DCM is not one of the initialized DCM(s), not cached nor ramped */
+		if ( u8_l_index == DCM_U8_NUMBER_OF_DCM )
+		{
+			DCM_writeDirection( pst_a_DCMConfig, u8_a_controlMode );
+		}
+		/* Check 1.2: DCM is initialized, write the Port(s) of its Direction Pins if ControlMode is changed */
+		else
+		{
+			DCM_writePorts( DCM_holdMode( u8_l_index, u8_a_controlMode ) );
+		}
+		
+		GLI_restoreGIE( u8_l_statusRegister );
+	}
+	/* Check 2: Pointer is equal to NULL, or ControlMode is not in the valid range */
 	else
 	{
-		/* Update error state = NOK, Pointer is NULL! */
+		/* Update error state = NOK, Pointer is NULL, or wrong ControlMode! */
 		u8_l_errorState = STD_TYPES_NOK;
 	}
 	
@@ -54,42 +241,54 @@ u8 DCM_initialization ( DCM_ST_CONFIG *pst_a_DCMConfig )
 
 /*******************************************************************************************************************************************************************/
 /*
- Name: DCM_controlDCM
- Input: Pointer to st DCMConfig and u8 ControlMode
+ Name: DCM_controlAll
+ Input: Pointer to u8 ControlModes ( one per DCM, in DCM_ST_CONFIG array order )
  Output: u8 Error or No Error
- Description: Function Control DCM with one of DCM Modes.
+ Description: Function Control all DCM(s) with one of DCM Modes each, simultaneously and at once ( one write per Direction Port of the changed DCM(s) ),
+			  each DCM takes its ControlMode as its Ramp target, so the Ramp holds it.
 */
-u8 DCM_controlDCM     ( DCM_ST_CONFIG *pst_a_DCMConfig, u8 u8_a_controlMode )
+u8 DCM_controlAll     ( const u8 *pu8_a_controlModes )
 {
 	/* Define local variable to set the error state = OK */
 	u8 u8_l_errorState = STD_TYPES_OK;
+	u8 u8_l_portsMask = 0;
+	u8 u8_l_index, u8_l_statusRegister;
 
-	/* Check 1: Pointer is not equal to NULL and ControlMode is in the valid range */
-	if ( ( pst_a_DCMConfig != NULL ) && ( u8_a_controlMode <= DCM_U8_ROTATE_CCW ) )
+	/* Check 1: DCM(s) are initialized and Pointer is not equal to NULL */
+	if ( ( pst_gs_DCMConfig != NULL ) && ( pu8_a_controlModes != NULL ) )
 	{
-		/* Check 1.1: Required ControlMode */
-		switch ( u8_a_controlMode )
+		/* Step 1: Check all ControlModes first, so no DCM is changed on a wrong one */
+		for ( u8_l_index = 0; u8_l_index < DCM_U8_NUMBER_OF_DCM; u8_l_index++ )
+		{
+			if ( pu8_a_controlModes[u8_l_index] > DCM_U8_BRAKE_THEN_COAST )
+			{
+				/* Update error state = NOK, wrong ControlMode! */
+				u8_l_errorState = STD_TYPES_NOK;
+			}
+		}
+		
+		/* Check 1.1: All ControlModes are valid */
+		if ( u8_l_errorState == STD_TYPES_OK )
 		{
-			case DCM_U8_STOP:
-				DIO_write( pst_a_DCMConfig->u8_g_directionCWPort, pst_a_DCMConfig->u8_g_directionCWPin, LOW );
-				DIO_write( pst_a_DCMConfig->u8_g_directionCCWPort, pst_a_DCMConfig->u8_g_directionCCWPin, LOW );
-			break;
+			/* Step 2: Hold off the Ramp ( tick ISR ), it shares the Ramp States, the applied Modes and the Direction Ports */
+			u8_l_statusRegister = GLI_saveAndDisableGIE();
+			
+			/* Step 3: Hold all ControlModes, collect the Ports of the changed DCM(s) */
+			for ( u8_l_index = 0; u8_l_index < DCM_U8_NUMBER_OF_DCM; u8_l_index++ )
+			{
+				u8_l_portsMask |= DCM_holdMode( u8_l_index, pu8_a_controlModes[u8_l_index] );
+			}
 			
-			case DCM_U8_ROTATE_CW:
-				DIO_write( pst_a_DCMConfig->u8_g_directionCWPort, pst_a_DCMConfig->u8_g_directionCWPin, HIGH );
-				DIO_write( pst_a_DCMConfig->u8_g_directionCCWPort, pst_a_DCMConfig->u8_g_directionCCWPin, LOW );
-			break;
+			/* Step 4: Apply all Direction Pins at once, per Port */
+			DCM_writePorts( u8_l_portsMask );
 			
-			case DCM_U8_ROTATE_CCW:
-				DIO_write( pst_a_DCMConfig->u8_g_directionCWPort, pst_a_DCMConfig->u8_g_directionCWPin, LOW );
-				DIO_write( pst_a_DCMConfig->u8_g_directionCCWPort, pst_a_DCMConfig->u8_g_directionCCWPin, HIGH );
-			break;
-		}	
+			GLI_restoreGIE( u8_l_statusRegister );
+		}
 	}
-	/* Check 2: Pointer is equal to NULL, or ControlMode is not in the valid range */
+	/* Check 2: DCM(s) are not initialized, or Pointer is equal to NULL */
 	else
 	{
-		/* Update error state = NOK, Pointer is NULL, or wrong ControlMode! */
+		/* Update error state = NOK, DCM(s) are not initialized, or Pointer is NULL! */
 		u8_l_errorState = STD_TYPES_NOK;
 	}
 	
@@ -101,26 +300,511 @@ u8 DCM_controlDCM     ( DCM_ST_CONFIG *pst_a_DCMConfig, u8 u8_a_controlMode )
  Name: DCM_controlDCMSpeed
  Input: u8 SpeedPercentage
  Output: u8 Error or No Error
- Description: Function Control DCM Speed.
+ Description: Function Control Speed of all DCM(s) at once ( no Ramp ), each DCM Trim is applied, and each DCM takes it as its Ramp target speed.
 */
 u8 DCM_controlDCMSpeed( u8 u8_a_speedPercentage )
 {
 	/* Define local variable to set the error state = OK */
 	u8 u8_l_errorState = STD_TYPES_OK;
+	u8 u8_l_statusRegister;
 
-	/* Check 1: SpeedPercentage are in the valid range */
-	if ( u8_a_speedPercentage <= DCM_U8_MAX_SPEED )
+	/* Check 1: DCM(s) are initialized, and SpeedPercentage is in the valid range */
+	if ( ( pst_gs_DCMConfig != NULL ) && ( u8_a_speedPercentage <= DCM_U8_MAX_SPEED ) )
 	{
-		PWM_generatePWM( u8_a_speedPercentage );
+		/* Step 1: Hold off the Ramp ( tick ISR ), it shares the Ramp States and the applied Speeds */
+		u8_l_statusRegister = GLI_saveAndDisableGIE();
+		
+		for ( u8 u8_l_index = 0; u8_l_index < DCM_U8_NUMBER_OF_DCM; u8_l_index++ )
+		{
+			u8_l_errorState &= DCM_holdSpeed( u8_l_index, u8_a_speedPercentage );
+		}
+		
+		GLI_restoreGIE( u8_l_statusRegister );
 	}	
-	/* Check 2: SpeedPercentage is not in the valid range */
+	/* Check 2: DCM(s) are not initialized, or SpeedPercentage is not in the valid range */
 	else
 	{
-		/* Update error state = NOK, wrong SpeedPercentage! */
+		/* Update error state = NOK, DCM(s) are not initialized, or wrong SpeedPercentage! */
 		u8_l_errorState = STD_TYPES_NOK;
 	}
 		
 	return u8_l_errorState;
 }
 
-/*******************************************************************************************************************************************************************/
\ No newline at end of file
+/*******************************************************************************************************************************************************************/
+/*
+ Name: DCM_setWheelSpeeds
+ Input: u8 LeftSpeedPercentage and u8 RightSpeedPercentage
+ Output: u8 Error or No Error
+ Description: Function Control Speed of Left and Right DCM(s) independently at once ( no Ramp ), to steer by speed difference ( DCM(s) must use different Speed Pins ).
+*/
+u8 DCM_setWheelSpeeds ( u8 u8_a_leftSpeedPercentage, u8 u8_a_rightSpeedPercentage )
+{
+	/* Define local variable to set the error state = OK */
+	u8 u8_l_errorState = STD_TYPES_OK;
+	u8 u8_l_statusRegister;
+
+	/* Check 1: DCM(s) are initialized, and SpeedPercentages are in the valid range */
+	if ( ( pst_gs_DCMConfig != NULL ) && ( u8_a_leftSpeedPercentage <= DCM_U8_MAX_SPEED ) && ( u8_a_rightSpeedPercentage <= DCM_U8_MAX_SPEED ) )
+	{
+		/* Step 1: Hold off the Ramp ( tick ISR ), it shares the Ramp States and the applied Speeds */
+		u8_l_statusRegister = GLI_saveAndDisableGIE();
+		
+		u8_l_errorState &= DCM_holdSpeed( DCM_U8_LEFT_DCM, u8_a_leftSpeedPercentage );
+		u8_l_errorState &= DCM_holdSpeed( DCM_U8_RIGHT_DCM, u8_a_rightSpeedPercentage );
+		
+		GLI_restoreGIE( u8_l_statusRegister );
+	}
+	/* Check 2: DCM(s) are not initialized, or SpeedPercentages are not in the valid range */
+	else
+	{
+		/* Update error state = NOK, DCM(s) are not initialized, or wrong SpeedPercentages! */
+		u8_l_errorState = STD_TYPES_NOK;
+	}
+		
+	return u8_l_errorState;
+}
+
+/*******************************************************************************************************************************************************************/
+/*
+ Name: DCM_getCacheCounters
+ Input: Pointer to u16 ReturnedHits and Pointer to u16 ReturnedMisses
+ Output: u8 Error or No Error
+ Description: Function to get the number of DCM_setTarget commands that repeated the pending target ( hits, redundant commands of the control loop ),
+			  and that changed it ( misses ), since DCM_initialization.
+*/
+u8 DCM_getCacheCounters( u16 *pu16_a_returnedHits, u16 *pu16_a_returnedMisses )
+{
+	/* Define local variable to set the error state = OK */
+	u8 u8_l_errorState = STD_TYPES_OK;
+
+	/* Check 1: Pointers are not equal to NULL */
+	if ( ( pu16_a_returnedHits != NULL ) && ( pu16_a_returnedMisses != NULL ) )
+	{
+		*pu16_a_returnedHits = u16_gs_cacheHits;
+		*pu16_a_returnedMisses = u16_gs_cacheMisses;
+	}
+	/* Check 2: Pointers are equal to NULL */
+	else
+	{
+		/* Update error state = NOK, Pointer is NULL! */
+		u8_l_errorState = STD_TYPES_NOK;
+	}
+	
+	return u8_l_errorState;
+}
+
+/*******************************************************************************************************************************************************************/
+/*
+ Name: DCM_setTarget
+ Input: u8 DCMIndex, u8 ControlMode, and u8 SpeedPercentage
+ Output: u8 Error or No Error
+ Description: Function to set the pending target motion of one DCM, applied with the other DCM(s) targets by DCM_commitTargets, the Ramp reaches it within the acceleration and deceleration limits,
+			  and a reversal passes through zero speed and the dwell, a Brake is applied at once ( SpeedPercentage is not used ) ( DCM_controlDCM, DCM_controlAll and speed functions replace the targets at once ).
+*/
+u8 DCM_setTarget      ( u8 u8_a_DCMIndex, u8 u8_a_controlMode, u8 u8_a_speedPercentage )
+{
+	/* Define local variable to set the error state = OK */
+	u8 u8_l_errorState = STD_TYPES_OK;
+
+	/* Check 1: DCMIndex, ControlMode and SpeedPercentage are in the valid range */
+	if ( ( u8_a_DCMIndex < DCM_U8_NUMBER_OF_DCM ) && ( u8_a_controlMode <= DCM_U8_BRAKE_THEN_COAST ) && ( u8_a_speedPercentage <= DCM_U8_MAX_SPEED ) )
+	{
+		/* Check 1.1: Target is already pending, a redundant command ( an earlier commit is not held ) */
+		if ( ( ast_gs_ramps[u8_a_DCMIndex].u8_g_pendingMode == u8_a_controlMode ) && ( ast_gs_ramps[u8_a_DCMIndex].u8_g_pendingSpeed == u8_a_speedPercentage ) )
+		{
+			u16_gs_cacheHits++;
+		}
+		/* Check 1.2: Target is changed */
+		else
+		{
+			u16_gs_cacheMisses++;
+			
+			/* Hold an earlier commit, so the Ramp never takes a half-written set of targets */
+			u8_gs_commitTargets = 0;
+			
+			ast_gs_ramps[u8_a_DCMIndex].u8_g_pendingSpeed = u8_a_speedPercentage;
+			ast_gs_ramps[u8_a_DCMIndex].u8_g_pendingMode = u8_a_controlMode;
+			u8_gs_targetsChanged = 1;
+		}
+	}
+	/* Check 2: DCMIndex, ControlMode or SpeedPercentage is not in the valid range */
+	else
+	{
+		/* Update error state = NOK, wrong DCMIndex, ControlMode or SpeedPercentage! */
+		u8_l_errorState = STD_TYPES_NOK;
+	}
+		
+	return u8_l_errorState;
+}
+
+/*******************************************************************************************************************************************************************/
+/*
+ Name: DCM_commitTargets
+ Input: void
+ Output: void
+ Description: Function to apply the pending targets of all DCM(s) together, the next Ramp step takes them in one go ( nothing to do if no target is changed ).
+*/
+void DCM_commitTargets ( void )
+{
+	if ( u8_gs_targetsChanged )
+	{
+		u8_gs_targetsChanged = 0;
+		u8_gs_commitTargets = 1;
+	}
+}
+
+/*******************************************************************************************************************************************************************/
+/*
+ Name: DCM_stepRamp
+ Input: void
+ Output: void
+ Description: Function to move every DCM one step towards its target ( called back from the system tick ISR every Ramp Period ),
+			  speed changes by the acceleration or deceleration step, a direction change first decelerates to zero, stops, and dwells,
+			  a Brake target brakes a rotating DCM at once, a timed Brake then coasts.
+*/
+static void DCM_stepRamp( void )
+{
+	DCM_ST_RAMP *pst_l_ramp;
+	u8 u8_l_targetMode, u8_l_targetSpeed, u8_l_speed;
+	u8 au8_l_modes[DCM_U8_NUMBER_OF_DCM];
+	u8 au8_l_speeds[DCM_U8_NUMBER_OF_DCM];
+	u8 u8_l_modesChanged = 0;
+	u8 u8_l_portsMask = 0;
+	u8 u8_l_index;
+	
+	/* Step 0: Take the committed targets of all DCM(s) together */
+	if ( u8_gs_commitTargets )
+	{
+		u8_gs_commitTargets = 0;
+		
+		for ( u8_l_index = 0; u8_l_index < DCM_U8_NUMBER_OF_DCM; u8_l_index++ )
+		{
+			ast_gs_ramps[u8_l_index].u8_g_targetMode = ast_gs_ramps[u8_l_index].u8_g_pendingMode;
+			ast_gs_ramps[u8_l_index].u8_g_targetSpeed = ast_gs_ramps[u8_l_index].u8_g_pendingSpeed;
+		}
+	}
+	
+	/* Loop: On all DCM(s) */
+	for ( u8_l_index = 0; u8_l_index < DCM_U8_NUMBER_OF_DCM; u8_l_index++ )
+	{
+		pst_l_ramp = &ast_gs_ramps[u8_l_index];
+		u8_l_targetMode = pst_l_ramp->u8_g_targetMode;
+		u8_l_targetSpeed = DCM_IS_ROTATING( u8_l_targetMode ) ? pst_l_ramp->u8_g_targetSpeed : 0;
+		u8_l_speed = pst_l_ramp->u8_g_currentSpeed;
+		
+		/* Check 1: DCM is dwelling at zero speed after a stop */
+		if ( pst_l_ramp->u8_g_dwell > 0 )
+		{
+			pst_l_ramp->u8_g_dwell--;
+		}
+		/* Check 2: Brake target, a rotating DCM brakes at once without deceleration ( a stopped DCM is held only by a held Brake ) */
+		else if ( ( ( u8_l_targetMode == DCM_U8_BRAKE ) || ( u8_l_targetMode == DCM_U8_BRAKE_THEN_COAST ) ) &&
+				  ( DCM_IS_ROTATING( pst_l_ramp->u8_g_currentMode ) || ( ( pst_l_ramp->u8_g_currentMode == DCM_U8_STOP ) && ( u8_l_targetMode == DCM_U8_BRAKE ) ) ) )
+		{
+			pst_l_ramp->u8_g_currentMode = DCM_U8_BRAKE;
+			pst_l_ramp->u8_g_brakeTime = ( u8_l_targetMode == DCM_U8_BRAKE_THEN_COAST ) ? DCM_U8_BRAKE_TIME : 0;
+			u8_l_speed = DCM_U8_BRAKE_SPEED;
+			u8_l_modesChanged = 1;
+		}
+		/* Check 3: DCM is braking, coast when the timed Brake ends or the target is no longer a Brake ( the DCM is already stopped, no dwell ) */
+		else if ( pst_l_ramp->u8_g_currentMode == DCM_U8_BRAKE )
+		{
+			if ( u8_l_targetMode == DCM_U8_BRAKE )
+			{
+				pst_l_ramp->u8_g_brakeTime = 0;
+			}
+			
+			if ( ( ( u8_l_targetMode != DCM_U8_BRAKE ) && ( u8_l_targetMode != DCM_U8_BRAKE_THEN_COAST ) ) ||
+				 ( ( pst_l_ramp->u8_g_brakeTime > 0 ) && ( --pst_l_ramp->u8_g_brakeTime == 0 ) ) )
+			{
+				pst_l_ramp->u8_g_currentMode = DCM_U8_STOP;
+				u8_l_speed = 0;
+				u8_l_modesChanged = 1;
+			}
+		}
+		/* Check 4: DCM is rotating or coasting */
+		else
+		{
+			/* Check 4.1: Direction must change, decelerate to zero first */
+			if ( DCM_IS_ROTATING( pst_l_ramp->u8_g_currentMode ) && ( pst_l_ramp->u8_g_currentMode != u8_l_targetMode ) )
+			{
+				u8_l_targetSpeed = 0;
+			}
+			/* Check 4.2: DCM is stopped and the target rotates it, set the direction and accelerate from zero */
+			else if ( ( pst_l_ramp->u8_g_currentMode == DCM_U8_STOP ) && DCM_IS_ROTATING( u8_l_targetMode ) )
+			{
+				pst_l_ramp->u8_g_currentMode = u8_l_targetMode;
+				u8_l_modesChanged = 1;
+			}
+			
+			/* Step 1: Move speed towards the target, within the limits */
+			if ( u8_l_speed < u8_l_targetSpeed )
+			{
+				u8_l_speed = ( ( u8_l_targetSpeed - u8_l_speed ) > DCM_U8_ACCELERATION_STEP ) ? ( u8_l_speed + DCM_U8_ACCELERATION_STEP ) : u8_l_targetSpeed;
+			}
+			else if ( u8_l_speed > u8_l_targetSpeed )
+			{
+				u8_l_speed = ( ( u8_l_speed - u8_l_targetSpeed ) > DCM_U8_DECELERATION_STEP ) ? ( u8_l_speed - DCM_U8_DECELERATION_STEP ) : u8_l_targetSpeed;
+			}
+			
+			/* Step 2: Zero speed reached on a direction change, stop, then dwell if the DCM is reversed */
+			if ( ( u8_l_speed == 0 ) && DCM_IS_ROTATING( pst_l_ramp->u8_g_currentMode ) && ( pst_l_ramp->u8_g_currentMode != u8_l_targetMode ) )
+			{
+				pst_l_ramp->u8_g_currentMode = DCM_U8_STOP;
+				u8_l_modesChanged = 1;
+				
+				if ( DCM_IS_ROTATING( u8_l_targetMode ) )
+				{
+					pst_l_ramp->u8_g_dwell = DCM_U8_REVERSE_DWELL;
+				}
+			}
+		}
+		
+		au8_l_modes[u8_l_index] = pst_l_ramp->u8_g_currentMode;
+		au8_l_speeds[u8_l_index] = u8_l_speed;
+	}
+	
+	/* Step 3: Apply speed decreases first, so the Speed Pin never drives a DCM harder than both its old and new directions */
+	for ( u8_l_index = 0; u8_l_index < DCM_U8_NUMBER_OF_DCM; u8_l_index++ )
+	{
+		if ( au8_l_speeds[u8_l_index] < ast_gs_ramps[u8_l_index].u8_g_currentSpeed )
+		{
+			ast_gs_ramps[u8_l_index].u8_g_currentSpeed = au8_l_speeds[u8_l_index];
+			DCM_applySpeed( u8_l_index, au8_l_speeds[u8_l_index] );
+		}
+	}
+	
+	/* Step 4: Apply the direction changes of all DCM(s) at once, one write per Direction Port of the changed DCM(s) */
+	if ( u8_l_modesChanged )
+	{
+		for ( u8_l_index = 0; u8_l_index < DCM_U8_NUMBER_OF_DCM; u8_l_index++ )
+		{
+			u8_l_portsMask |= DCM_setAppliedMode( u8_l_index, au8_l_modes[u8_l_index] );
+		}
+		
+		DCM_writePorts( u8_l_portsMask );
+	}
+	
+	/* Step 5: Apply speed increases last */
+	for ( u8_l_index = 0; u8_l_index < DCM_U8_NUMBER_OF_DCM; u8_l_index++ )
+	{
+		if ( au8_l_speeds[u8_l_index] > ast_gs_ramps[u8_l_index].u8_g_currentSpeed )
+		{
+			ast_gs_ramps[u8_l_index].u8_g_currentSpeed = au8_l_speeds[u8_l_index];
+			DCM_applySpeed( u8_l_index, au8_l_speeds[u8_l_index] );
+		}
+	}
+}
+
+/*******************************************************************************************************************************************************************/
+/*
+ Name: DCM_getIndex
+ Input: Pointer to st DCMConfig
+ Output: u8 DCMIndex, or DCM_U8_NUMBER_OF_DCM if DCMConfig is not one of the initialized DCM(s)
+ Description: Function to get the index of DCMConfig in the DCM(s) Configurations array.
+*/
+static u8 DCM_getIndex( DCM_ST_CONFIG *pst_a_DCMConfig )
+{
+	u8 u8_l_index = 0;
+	
+	if ( pst_gs_DCMConfig != NULL )
+	{
+		while ( ( u8_l_index < DCM_U8_NUMBER_OF_DCM ) && ( &pst_gs_DCMConfig[u8_l_index] != pst_a_DCMConfig ) )
+		{
+			u8_l_index++;
+		}
+	}
+	else
+	{
+		u8_l_index = DCM_U8_NUMBER_OF_DCM;
+	}
+	
+	return u8_l_index;
+}
+
+/*******************************************************************************************************************************************************************/
+/*
+ Name: DCM_writeDirection
+ Input: Pointer to st DCMConfig and u8 ControlMode
+ Output: void
+ Description: Function to write ControlMode on both Direction Pins of DCM ( not cached ), DCM is not one of the initialized DCM(s).
+*/
+static void DCM_writeDirection( DCM_ST_CONFIG *pst_a_DCMConfig, u8 u8_a_controlMode )
+{
+	/* Step 1: An inverted DCM rotates CW on its CCW Pin */
+	if ( ( pst_a_DCMConfig->u8_g_polarity == DCM_U8_POLARITY_INVERTED ) && DCM_IS_ROTATING( u8_a_controlMode ) )
+	{
+		u8_a_controlMode = ( u8_a_controlMode == DCM_U8_ROTATE_CW ) ? DCM_U8_ROTATE_CCW : DCM_U8_ROTATE_CW;
+	}
+	
+	/* Check 1: Required ControlMode */
+	switch ( u8_a_controlMode )
+	{
+		case DCM_U8_STOP:
+			DIO_write( pst_a_DCMConfig->u8_g_directionCWPort, pst_a_DCMConfig->u8_g_directionCWPin, LOW );
+			DIO_write( pst_a_DCMConfig->u8_g_directionCCWPort, pst_a_DCMConfig->u8_g_directionCCWPin, LOW );
+		break;
+		
+		case DCM_U8_ROTATE_CW:
+			DIO_write( pst_a_DCMConfig->u8_g_directionCWPort, pst_a_DCMConfig->u8_g_directionCWPin, HIGH );
+			DIO_write( pst_a_DCMConfig->u8_g_directionCCWPort, pst_a_DCMConfig->u8_g_directionCCWPin, LOW );
+		break;
+		
+		case DCM_U8_ROTATE_CCW:
+			DIO_write( pst_a_DCMConfig->u8_g_directionCWPort, pst_a_DCMConfig->u8_g_directionCWPin, LOW );
+			DIO_write( pst_a_DCMConfig->u8_g_directionCCWPort, pst_a_DCMConfig->u8_g_directionCCWPin, HIGH );
+		break;
+		
+		case DCM_U8_BRAKE:
+			DIO_write( pst_a_DCMConfig->u8_g_directionCWPort, pst_a_DCMConfig->u8_g_directionCWPin, HIGH );
+			DIO_write( pst_a_DCMConfig->u8_g_directionCCWPort, pst_a_DCMConfig->u8_g_directionCCWPin, HIGH );
+		break;
+	}	
+}
+
+/*******************************************************************************************************************************************************************/
+/*
+ Name: DCM_applySpeed
+ Input: u8 DCMIndex and u8 SpeedPercentage
+ Output: u8 Error or No Error
+ Description: Function to apply SpeedPercentage, scaled by the DCM Trim, on the Speed Pin of one initialized DCM, if it is not already applied.
+*/
+static u8 DCM_applySpeed( u8 u8_a_DCMIndex, u8 u8_a_speedPercentage )
+{
+	/* Define local variable to set the error state = OK */
+	u8 u8_l_errorState = STD_TYPES_OK;
+	
+	/* Check 1: SpeedPercentage is changed, already applied is skipped */
+	if ( au8_gs_appliedSpeeds[u8_a_DCMIndex] != u8_a_speedPercentage )
+	{
+		au8_gs_appliedSpeeds[u8_a_DCMIndex] = u8_a_speedPercentage;
+		u8_l_errorState = PWM_generateChannelPWM( pst_gs_DCMConfig[u8_a_DCMIndex].u8_g_speedPort, pst_gs_DCMConfig[u8_a_DCMIndex].u8_g_speedPin,
+												  ( u8 ) ( ( ( u16 ) u8_a_speedPercentage * pst_gs_DCMConfig[u8_a_DCMIndex].u8_g_trim ) / DCM_U8_MAX_TRIM ) );
+	}
+	
+	return u8_l_errorState;
+}
+
+/*******************************************************************************************************************************************************************/
+/*
+ Name: DCM_setAppliedMode
+ Input: u8 DCMIndex and u8 ControlMode ( DCM_U8_STOP to DCM_U8_BRAKE )
+ Output: u8 PortsMask of the DCM Direction Ports to write, 0 if ControlMode is already applied
+ Description: Function to store ControlMode as the applied Mode of one initialized DCM, written by DCM_writePorts.
+*/
+static u8 DCM_setAppliedMode( u8 u8_a_DCMIndex, u8 u8_a_controlMode )
+{
+	u8 u8_l_portsMask = 0;
+	
+	if ( au8_gs_appliedModes[u8_a_DCMIndex] != u8_a_controlMode )
+	{
+		au8_gs_appliedModes[u8_a_DCMIndex] = u8_a_controlMode;
+		u8_l_portsMask = ( 1 << ast_gs_directionPins[u8_a_DCMIndex].u8_g_CWPortIndex ) | ( 1 << ast_gs_directionPins[u8_a_DCMIndex].u8_g_CCWPortIndex );
+	}
+	
+	return u8_l_portsMask;
+}
+
+/*******************************************************************************************************************************************************************/
+/*
+ Name: DCM_holdMode
+ Input: u8 DCMIndex and u8 ControlMode
+ Output: u8 PortsMask of the DCM Direction Ports to write, 0 if ControlMode is already applied
+ Description: Function to make ControlMode the pending, target and current Mode of one initialized DCM, the Ramp holds it ( interrupts must be disabled ),
+			  a timed Brake is a Brake, the Ramp coasts after DCM_U8_BRAKE_TIME Ramp Periods.
+*/
+static u8 DCM_holdMode( u8 u8_a_DCMIndex, u8 u8_a_controlMode )
+{
+	DCM_ST_RAMP *pst_l_ramp = &ast_gs_ramps[u8_a_DCMIndex];
+	
+	pst_l_ramp->u8_g_pendingMode = u8_a_controlMode;
+	pst_l_ramp->u8_g_targetMode = u8_a_controlMode;
+	pst_l_ramp->u8_g_currentMode = ( u8_a_controlMode == DCM_U8_BRAKE_THEN_COAST ) ? DCM_U8_BRAKE : u8_a_controlMode;
+	pst_l_ramp->u8_g_brakeTime = ( u8_a_controlMode == DCM_U8_BRAKE_THEN_COAST ) ? DCM_U8_BRAKE_TIME : 0;
+	pst_l_ramp->u8_g_dwell = 0;
+	
+	return DCM_setAppliedMode( u8_a_DCMIndex, pst_l_ramp->u8_g_currentMode );
+}
+
+/*******************************************************************************************************************************************************************/
+/*
+ Name: DCM_holdSpeed
+ Input: u8 DCMIndex and u8 SpeedPercentage
+ Output: u8 Error or No Error
+ Description: Function to make SpeedPercentage the pending, target and current Speed of one initialized DCM and apply it, the Ramp holds it while the DCM rotates ( interrupts must be disabled ).
+*/
+static u8 DCM_holdSpeed( u8 u8_a_DCMIndex, u8 u8_a_speedPercentage )
+{
+	ast_gs_ramps[u8_a_DCMIndex].u8_g_pendingSpeed = u8_a_speedPercentage;
+	ast_gs_ramps[u8_a_DCMIndex].u8_g_targetSpeed = u8_a_speedPercentage;
+	ast_gs_ramps[u8_a_DCMIndex].u8_g_currentSpeed = u8_a_speedPercentage;
+	
+	return DCM_applySpeed( u8_a_DCMIndex, u8_a_speedPercentage );
+}
+
+/*******************************************************************************************************************************************************************/
+/*
+ Name: DCM_writePorts
+ Input: u8 PortsMask ( bit n: index n in the Direction Ports array )
+ Output: void
+ Description: Function to write the applied ControlModes of all DCM(s) on the masked Direction Ports, one masked write per Port.
+*/
+static void DCM_writePorts( u8 u8_a_portsMask )
+{
+	u8 au8_l_portValues[DCM_U8_MAX_PORTS] = { 0 };
+	u8 u8_l_index;
+	
+	/* Step 1: Build the Ports values, STOP leaves both Direction Pins LOW, BRAKE sets both HIGH */
+	for ( u8_l_index = 0; u8_l_index < DCM_U8_NUMBER_OF_DCM; u8_l_index++ )
+	{
+		if ( ( au8_gs_appliedModes[u8_l_index] == DCM_U8_ROTATE_CW ) || ( au8_gs_appliedModes[u8_l_index] == DCM_U8_BRAKE ) )
+		{
+			au8_l_portValues[ast_gs_directionPins[u8_l_index].u8_g_CWPortIndex] |= ast_gs_directionPins[u8_l_index].u8_g_CWMask;
+		}
+		
+		if ( ( au8_gs_appliedModes[u8_l_index] == DCM_U8_ROTATE_CCW ) || ( au8_gs_appliedModes[u8_l_index] == DCM_U8_BRAKE ) )
+		{
+			au8_l_portValues[ast_gs_directionPins[u8_l_index].u8_g_CCWPortIndex] |= ast_gs_directionPins[u8_l_index].u8_g_CCWMask;
+		}
+	}
+	
+	/* Step 2: Write the masked Ports */
+	for ( u8_l_index = 0; u8_l_index < u8_gs_numberOfPorts; u8_l_index++ )
+	{
+		if ( GET_BIT( u8_a_portsMask, u8_l_index ) )
+		{
+			DIO_writePortMasked( ast_gs_directionPorts[u8_l_index].u8_g_port, ast_gs_directionPorts[u8_l_index].u8_g_mask, au8_l_portValues[u8_l_index] );
+		}
+	}
+}
+
+/*******************************************************************************************************************************************************************/
+/*
+ Name: DCM_addPort
+ Input: u8 Port and u8 Pin
+ Output: u8 Index of Port in the Direction Ports array
+ Description: Function to add a Direction Pin to the mask of its Port, the Port is added on its first Pin.
+*/
+static u8 DCM_addPort( u8 u8_a_port, u8 u8_a_pin )
+{
+	u8 u8_l_index = 0;
+	
+	while ( ( u8_l_index < u8_gs_numberOfPorts ) && ( ast_gs_directionPorts[u8_l_index].u8_g_port != u8_a_port ) )
+	{
+		u8_l_index++;
+	}
+	
+	if ( u8_l_index == u8_gs_numberOfPorts )
+	{
+		ast_gs_directionPorts[u8_l_index].u8_g_port = u8_a_port;
+		ast_gs_directionPorts[u8_l_index].u8_g_mask = 0;
+		u8_gs_numberOfPorts++;
+	}
+	
+	SET_BIT( ast_gs_directionPorts[u8_l_index].u8_g_mask, u8_a_pin );
+	
+	return u8_l_index;
+}
+
+/*******************************************************************************************************************************************************************/
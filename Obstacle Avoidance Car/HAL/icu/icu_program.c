@@ -7,63 +7,140 @@
 
 /*============= FILE INCLUSION =============*/
 #include "icu_interface.h"
+/*============= TYPE DEFINITION =============*/
+typedef struct
+{
+	void (*callBack)(void);			//user function called after each captured edge
+	volatile u16 riseTime;			//timer1 value of last rising edge
+	volatile u16 fallTime;			//timer1 value of last falling edge
+	volatile u16 lastTime;			//timer1 value of last captured edge
+	EN_ICU_EdgeType edge;			//edge being waited for
+	u8 used;						//channel is initialized
+}ST_ICU_Channel;
+
 /*============= GLOBAL VARIBALE =============*/
-static EN_ICU_EdgeType EN_g_edge;
-static EN_ICU_Source EN_g_source;
+static ST_ICU_Channel ST_g_channels[MAX_INT];
+static EN_ICU_Clock EN_g_clock=NO_CLOCK;	//clock of the shared free running timebase, NO_CLOCK if stopped
+
+/*============= PRIVATE FUNCTIONS =============*/
+
+//store timestamp in the slot of the armed edge, then call back user
+static void ICU_edgeHandler(EN_ICU_Source source,u16 time)
+{
+	ST_g_channels[source].lastTime=time;
+	if(ST_g_channels[source].edge == RISING)
+		ST_g_channels[source].riseTime=time;
+	else
+		ST_g_channels[source].fallTime=time;
+	if(ST_g_channels[source].callBack != NULL)
+		ST_g_channels[source].callBack();
+}
+
+static void ICU_int0Handler(void)
+{
+	ICU_edgeHandler(EN_INT0,TMR1_readTime());
+}
+
+static void ICU_int1Handler(void)
+{
+	ICU_edgeHandler(EN_INT1,TMR1_readTime());
+}
+
+static void ICU_int2Handler(void)
+{
+	ICU_edgeHandler(EN_INT2,TMR1_readTime());
+}
+
+static void ICU_icp1Handler(void)
+{
+	ICU_edgeHandler(EN_ICP1,TMR1_readCapture());
+}
+
+static void (*const g_handlers[MAX_INT])(void)={ICU_int0Handler,ICU_int1Handler,ICU_int2Handler,ICU_icp1Handler};
 
-/*============= FUNCTION PROTOTYPE =============*/
+/*============= FUNCTION DEFINITIONS =============*/
 
 /*
- * Description : Function to initialize the ICU driver
- * 	1. Set the required clock.
+ * Description : Function to initialize one ICU channel
+ * 	1. Set the required clock, timer1 is started free running by the first channel (or the system tick) and shared by all channels.
  * 	2. Set the required edge detection.
- * 	3. Enable the External Interrupt source.
- * 	4. Initialize Timer1 Registers
+ * 	3. Enable the External Interrupt source, or Timer1 input capture interrupt for EN_ICP1.
  */
 EN_state ICU_init(const ST_ICU_ConfigType * Config_Ptr)
 {
-	if(Config_Ptr != NULL)
+	if(Config_Ptr != NULL && Config_Ptr->source < MAX_INT && !ST_g_channels[Config_Ptr->source].used
+	   && Config_Ptr->clock > NO_CLOCK && Config_Ptr->clock < MAX_F_CPU)
 	{
-		ST_TME1_ConfigType ST_L_Timer;
-		ST_L_Timer.CLK_source=Config_Ptr->clock;
-		ST_L_Timer.TMR_mode=Normal;
-		ST_L_Timer.INT_state=Disable;
-		TMR1_init(&ST_L_Timer);
-		EXI_enablePIE(Config_Ptr->source,Config_Ptr->edge);
-		EN_g_edge=Config_Ptr->edge;
-		EN_g_source=Config_Ptr->source;
+		if(EN_g_clock == NO_CLOCK && TMR1_getClock() == NO_CLK)
+		{
+			//start shared timebase, never cleared while running (noise canceler only affects ICP1 capture)
+			ST_TME1_ConfigType ST_L_Timer={Normal,(EN_TMR_CLK)Config_Ptr->clock,Disable,INPUT_CAPT,TMR_RISING,Normal_mode,Noise_Enable};
+			TMR1_init(&ST_L_Timer);
+			EN_g_clock=Config_Ptr->clock;
+		}
+		else if(EN_g_clock == NO_CLOCK && TMR1_getClock() == (EN_TMR_CLK)Config_Ptr->clock)
+		{
+			//timebase already started by the system tick, use it as is
+			EN_g_clock=Config_Ptr->clock;
+		}
+		else if(EN_g_clock != Config_Ptr->clock)
+		{
+			return invalid;
+		}
+		ST_g_channels[Config_Ptr->source].callBack=NULL;
+		ST_g_channels[Config_Ptr->source].used=1;
+		ICU_setEdgeDetectionType(Config_Ptr->source,Config_Ptr->edge);
+		if(Config_Ptr->source == EN_ICP1)
+		{
+			TMR1_setCaptureCallBack(g_handlers[EN_ICP1]);
+			TMR1_enableInterrupt(INPUT_CAPT);
+		}
+		else
+		{
+			EXI_intSetCallBack(Config_Ptr->source,g_handlers[Config_Ptr->source]);
+		}
 		return valid;
 	}
 	return invalid;
 }
 
 /*
- * Description: Function to set the Call Back function address.
+ * Description: Function to set the Call Back function address of a channel.
  */
-EN_state ICU_setCallBack(void(*a_ptr)(void))
+EN_state ICU_setCallBack(EN_ICU_Source source,void(*a_ptr)(void))
 {
-	if(a_ptr != NULL)
+	if(a_ptr != NULL && source < MAX_INT)
 	{
-		EXI_intSetCallBack(EN_g_source,a_ptr);
+		ST_g_channels[source].callBack=a_ptr;
 		return valid;
 	}
 	return invalid;
 }
 
 /*
- * Description: Function to set the required edge detection.
+ * Description: Function to set the required edge detection of a channel.
  */
-EN_state ICU_setEdgeDetectionType(const EN_ICU_EdgeType edgeType)
+EN_state ICU_setEdgeDetectionType(EN_ICU_Source source,const EN_ICU_EdgeType edgeType)
 {
 	EN_state en_l_state;
-		if(edgeType==RISING)
+		if(source >= MAX_INT)
+			en_l_state=invalid;
+		else if(edgeType==RISING)
 		{
-			EXI_enablePIE(EN_g_source,EXI_U8_SENSE_RISING_EDGE);
+			ST_g_channels[source].edge=RISING;
+			if(source == EN_ICP1)
+				TMR1_setCaptureEdge(TMR_RISING);
+			else
+				EXI_enablePIE(source,EXI_U8_SENSE_RISING_EDGE);
 			en_l_state=valid;
 		}
 		else if(edgeType==FALLING)
 		{
-			EXI_enablePIE(EN_g_source,EXI_U8_SENSE_FALLING_EDGE);
+			ST_g_channels[source].edge=FALLING;
+			if(source == EN_ICP1)
+				TMR1_setCaptureEdge(TMR_FALLING);
+			else
+				EXI_enablePIE(source,EXI_U8_SENSE_FALLING_EDGE);
 			en_l_state=valid;
 		}
 		else
@@ -73,27 +150,46 @@ EN_state ICU_setEdgeDetectionType(const EN_ICU_EdgeType edgeType)
 }
 
 /*
- * Description: Function to get the Timer1 Value when the input is captured
- *              The value stored at Input Capture Register ICR1
+ * Description: Function to get the Timer1 Value of the last captured edge of a channel
+ *              The value stored at Input Capture Register ICR1 (EN_ICP1), or TCNT1 read in the external interrupt ISR
  */
-u16 ICU_getInputCaptureValue(void)
+u16 ICU_getInputCaptureValue(EN_ICU_Source source)
 {
-	return TMR1_readTime();
+	if(source < MAX_INT)
+		return ST_g_channels[source].lastTime;
+	return 0;
 }
 
 /*
- * Description: Function to clear the Timer1 Value to start count from ZERO
+ * Description: Function to get the time between the last rising and the following falling edge of a channel
+ *              unsigned subtraction gives the right result across one timer1 overflow
  */
-void ICU_clearTimerValue(void)
+u16 ICU_getHighTime(EN_ICU_Source source)
 {
-	TMR1_clear();
+	if(source < MAX_INT)
+		return (u16)(ST_g_channels[source].fallTime - ST_g_channels[source].riseTime);
+	return 0;
 }
 
 /*
- * Description: Function to disable the Timer1 to stop the ICU Driver
+ * Description: Function to disable one channel, Timer1 is stopped when no channel is used and the system tick is not running on it
  */
-void ICU_DeInit(void)
+void ICU_DeInit(EN_ICU_Source source)
 {
-	EXI_disablePIE(EN_g_source);
-	TMR1_stop();
-}
\ No newline at end of file
+	u8 index,used=0;
+	if(source < MAX_INT && ST_g_channels[source].used)
+	{
+		if(source == EN_ICP1)
+			TMR1_disableInterrupt(INPUT_CAPT);
+		else
+			EXI_disablePIE(source);
+		ST_g_channels[source].used=0;
+		for(index=0;index<MAX_INT;index++)
+			used|=ST_g_channels[index].used;
+		if(!used && !TMR1_isSystemTickRunning())
+		{
+			TMR1_stop();
+			EN_g_clock=NO_CLOCK;
+		}
+	}
+}
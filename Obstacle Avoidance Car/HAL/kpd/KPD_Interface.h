@@ -16,10 +16,10 @@
 #include "../../LIB/std_types/std_types.h"
 #include "../../LIB/bit_math/bit_math.h"
 #include "../../LIB/mcu_config/mcu_config.h"
+#include "../../LIB/swt/swt_interface.h"
 
 /* MCAL */
 #include "../../MCAL/dio/dio_interface.h"
-#include "../../MCAL/tmr0/tmr0_interface.h"
 
 /*******************************************************************************************************************************************************************/
 /* KPD Macros */
@@ -39,6 +39,7 @@ void KPD_enableKPD     ( void );
 void KPD_disableKPD    ( void );
 
 u8 KPD_getPressedKey   ( u8 *pu8_a_returnedKeyValue );
+u8 KPD_scanKey		   ( u8 *pu8_a_returnedKeyValue );
 
 /*******************************************************************************************************************************************************************/
 
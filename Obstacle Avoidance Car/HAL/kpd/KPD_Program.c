@@ -20,6 +20,16 @@ static const u8 Au8_gs_keys[1][2] = KPD_AU8_KEYS;
 static const u8 Au8_gs_rowsPins[1] = { KPD_U8_R1_PIN };
 static const u8 Au8_gs_colsPins[2] = { KPD_U8_C1_PIN, KPD_U8_C2_PIN };
 
+/* Global variables of KPD_scanKey debounce, kept between calls */
+static u8 u8_gs_sampledKey = KPD_U8_KEY_NOT_PRESSED;	/* Key of the last sample */
+static u8 u8_gs_samplesCount = 0;						/* Consecutive samples of the same Key, max. KPD_U8_DEBOUNCE_SAMPLES */
+static u8 u8_gs_debouncedKey = KPD_U8_KEY_NOT_PRESSED;	/* Key accepted after debouncing */
+
+/*******************************************************************************************************************************************************************/
+/* KPD Private Functions' Prototypes */
+
+static u8 KPD_sampleKey( void );
+
 /*******************************************************************************************************************************************************************/
 /*
  Name: KPD_initialization
@@ -77,7 +87,7 @@ void KPD_disableKPD    ( void )
  Name: KPD_getPressedKey
  Input: Pointer to u8 ReturnedKeyValue
  Output: u8 Error or No Error
- Description: Function to check for the pressed key.
+ Description: Function to check for the pressed key, it blocks for the debouncing time and until the Key is released ( use KPD_scanKey in periodic Tasks ).
 */
 u8 KPD_getPressedKey   ( u8 *pu8_a_returnedKeyValue )
 {
@@ -111,7 +121,7 @@ u8 KPD_getPressedKey   ( u8 *pu8_a_returnedKeyValue )
 					/* Push buttons often generate spurious open/close transitions when pressed, due to mechanical and physical issues: these transitions may be read as multiple presses in a very short time fooling the program. This example demonstrates how to debounce an input, which means checking twice in a short period of time to make sure the pushbutton is definitely pressed. Without debouncing, pressing the button once may cause unpredictable results. */
 					/* Delay debouncing time of the Key */
 					//_delay_ms( 20 );
-					TMR0_delayMS( 20 );
+					SWT_delayMS( 20 );
 					
 					/* Step 4: Recheck if the Key is still Pressed */
 					DIO_read( KPD_U8_INPUT_PORT, Au8_gs_colsPins[Loc_u8ColsCounter], &u8_l_pinValue );
@@ -155,4 +165,92 @@ u8 KPD_getPressedKey   ( u8 *pu8_a_returnedKeyValue )
 	return u8_l_errorState;	
 }
 
+/*******************************************************************************************************************************************************************/
+/*
+ Name: KPD_scanKey
+ Input: Pointer to u8 ReturnedKeyValue
+ Output: u8 Error or No Error
+ Description: Function to sample the keys once without blocking ( to be called periodically ), a Key is debounced when it is sampled KPD_U8_DEBOUNCE_SAMPLES
+			  consecutive calls, it is returned once on its debounced press, otherwise Not Pressed value is returned.
+*/
+u8 KPD_scanKey		   ( u8 *pu8_a_returnedKeyValue )
+{
+	/* Define local variable to set the error state = OK */
+	u8 u8_l_errorState = STD_TYPES_OK;
+	
+	/* Check 1: Pointer is not equal to NULL */
+	if ( pu8_a_returnedKeyValue != NULL )
+	{
+		u8 u8_l_key = KPD_sampleKey();
+		
+		*pu8_a_returnedKeyValue = KPD_U8_KEY_NOT_PRESSED;
+		
+		/* Check 1.1: Same Key as the last sample, count it */
+		if ( u8_l_key == u8_gs_sampledKey )
+		{
+			if ( u8_gs_samplesCount < KPD_U8_DEBOUNCE_SAMPLES )
+			{
+				u8_gs_samplesCount++;
+			}
+		}
+		/* Check 1.2: Key changed ( bounce, press or release ), restart counting */
+		else
+		{
+			u8_gs_sampledKey = u8_l_key;
+			u8_gs_samplesCount = 1;
+		}
+		
+		/* Check 1.3: Key is debounced and changed, report a press only ( a release returns Not Pressed ) */
+		if ( ( u8_gs_samplesCount >= KPD_U8_DEBOUNCE_SAMPLES ) && ( u8_l_key != u8_gs_debouncedKey ) )
+		{
+			u8_gs_debouncedKey = u8_l_key;
+			*pu8_a_returnedKeyValue = u8_l_key;
+		}
+	}
+	/* Check 2: Pointer is equal to NULL */
+	else
+	{
+		/* Update error state = NOK, Pointer is NULL! */
+		u8_l_errorState = STD_TYPES_NOK;
+	}
+	
+	return u8_l_errorState;
+}
+
+/*******************************************************************************************************************************************************************/
+/*
+ Name: KPD_sampleKey
+ Input: void
+ Output: u8 KeyValue ( Not Pressed value if no Key is pressed )
+ Description: Function to read all keys once, without debouncing.
+*/
+static u8 KPD_sampleKey( void )
+{
+	u8 u8_l_pinValue;
+	u8 u8_l_keyValue = KPD_U8_KEY_NOT_PRESSED;
+	
+	/* Loop: On Rows -> Output ( i.e.: Set Pin ) */
+	for ( u8 u8_l_row = 0; ( u8_l_row < 1 ) && ( u8_l_keyValue == KPD_U8_KEY_NOT_PRESSED ); u8_l_row++ )
+	{
+		/* Step 1: Activate Row ( i.e. Set Pin Low ) */
+		DIO_write( KPD_U8_OUTPUT_PORT, Au8_gs_rowsPins[u8_l_row], LOW );
+		
+		/* Loop: On Columns -> Input ( i.e. Get Pin ), until a Key is Pressed */
+		for ( u8 u8_l_col = 0; ( u8_l_col <= 1 ) && ( u8_l_keyValue == KPD_U8_KEY_NOT_PRESSED ); u8_l_col++ )
+		{
+			DIO_read( KPD_U8_INPUT_PORT, Au8_gs_colsPins[u8_l_col], &u8_l_pinValue );
+			
+			if ( u8_l_pinValue == LOW )
+			{
+				u8_l_keyValue = Au8_gs_keys[u8_l_row][u8_l_col];
+			}
+		}
+		
+		/* Step 2: Deactivate Row ( i.e. Set Pin High ) */
+		DIO_write( KPD_U8_OUTPUT_PORT, Au8_gs_rowsPins[u8_l_row], HIGH );
+	}
+	
+	return u8_l_keyValue;
+}
+
 /*******************************************************************************************************************************************************************/
\ No newline at end of file
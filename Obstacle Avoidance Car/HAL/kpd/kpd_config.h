@@ -66,6 +66,10 @@
 /* KPD Configured Keys */
 #define KPD_AU8_KEYS	  	  { { '1', '2' } }
 
+/* KPD Debounce Samples, consecutive KPD_scanKey calls a Key must be sampled in before it is accepted,
+   debouncing time is ( KPD_U8_DEBOUNCE_SAMPLES - 1 ) * calls period ( i.e. 2 samples at 20 ms are 20 ms ) */
+#define KPD_U8_DEBOUNCE_SAMPLES	2
+
 /* End of Configurations */
 
 /*******************************************************************************************************************************************************************/
@@ -52,6 +52,42 @@
 #define Mode bit_4
 /************************************************************************/
 /************************************************************************/
+/* LCD Wait Modes ( before each instruction, until the previous one is executed ) */
+#define busy_flag 0						//poll the Busy Flag ( D7 ), needs the RW pin wired
+#define fixed_delay 1					//wait the datasheet execution times
+
+/************************************************************************/
+/*  Wait Mode Choose ( busy_flag or fixed_delay )						*/
+/*  busy_flag falls back to fixed_delay if the Busy Flag never clears	*/
+/************************************************************************/
+#define Wait_Mode busy_flag
+
+/* Max. time to poll the Busy Flag ( in us ), more than the longest instruction */
+#define LCD_Busy_Timeout_US 2000
+/* Execution times ( in us ), datasheet max. at fosc = 250 KHz */
+#define LCD_Clear_Time_US 1640			//Clear Display and Return Home
+#define LCD_Command_Time_US 40			//all other instructions, and data write
+/************************************************************************/
+/* LCD Size, of the shadow Frame ( LCD_writeFrame... and LCD_flushFrame ) */
+#define LCD_Rows 2
+#define LCD_Columns 16
+
+/************************************************************************/
+/* LCD Write Modes */
+#define blocking 0						//each API call waits for LCD, then writes
+#define queued 1						//API calls queue bytes, written from the system tick at LCD pace
+
+/************************************************************************/
+/*  Write Mode Choose ( blocking or queued )							*/
+/************************************************************************/
+#define Write_Mode queued
+
+/* Queue size ( in bytes, power of 2, max. 128 ), must hold the longest burst of API calls ( one byte waits per instruction ) */
+#define LCD_Queue_Size 64
+/* Drain period ( in ms ), one queued byte is written per period */
+#define LCD_Drain_Period_MS 1
+/************************************************************************/
+/************************************************************************/
 /*							Definitions										*/
 /************************************************************************/
 /*
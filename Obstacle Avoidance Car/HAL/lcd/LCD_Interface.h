@@ -18,10 +18,10 @@
 #include "../../LIB/std_types/std_types.h"
 #include "../../LIB/bit_math/bit_math.h"
 #include "../../LIB/mcu_config/mcu_config.h"
+#include "../../LIB/swt/swt_interface.h"
 
 /* MCAL */
 #include "../../MCAL/dio/dio_interface.h"
-#include "../../MCAL/tmr0/tmr0_interface.h"
 
 /*******************************************************************************************************************************************************************/
 
@@ -44,7 +44,19 @@ void LCD_clear ( void );
 void LCD_setCursor ( u8 u8_a_row, u8 u8_a_column );
 void LCD_sendString ( u8 *pu8_a_string );
 void LCD_floatToString ( f32 f32_a_floatValue );
+void LCD_sendUnsigned ( u16 u16_a_value );
+void LCD_sendFixedPoint ( u16 u16_a_value, u8 u8_a_decimals );
+void LCD_sendUnsignedAligned ( u16 u16_a_value, u8 u8_a_width );
+void LCD_sendFixedPointAligned ( u16 u16_a_value, u8 u8_a_decimals, u8 u8_a_width );
 void LCD_createCustomCharacter ( u8 *pu8_a_pattern, u8 u8_a_location );
+void LCD_clearFrame ( void );
+void LCD_writeFrameCharacter ( u8 u8_a_row, u8 u8_a_column, u8 u8_a_char );
+void LCD_writeFrameString ( u8 u8_a_row, u8 u8_a_column, u8 *pu8_a_string );
+void LCD_writeFrameFloat ( u8 u8_a_row, u8 u8_a_column, f32 f32_a_floatValue );
+void LCD_writeFrameUnsigned ( u8 u8_a_row, u8 u8_a_column, u16 u16_a_value, u8 u8_a_width );
+void LCD_writeFrameFixedPoint ( u8 u8_a_row, u8 u8_a_column, u16 u16_a_value, u8 u8_a_decimals, u8 u8_a_width );
+u8   LCD_flushFrame ( void );
+void LCD_getQueueStatistics ( u16 *pu16_a_returnedDrops, u8 *pu8_a_returnedHighWaterMark );
 
 /*******************************************************************************************************************************************************************/
 
@@ -12,6 +12,52 @@
 #include "lcd_config.h"
 #include "lcd_interface.h"
 
+#if (Write_Mode == queued) && ((LCD_Queue_Size & (LCD_Queue_Size - 1)) || (LCD_Queue_Size > 128))
+#error "LCD: LCD_Queue_Size must be a power of 2, max. 128"
+#endif
+
+#if (LCD_Rows < 1) || (LCD_Rows > 4)
+#error "LCD: LCD_Rows must be 1 to 4"
+#endif
+
+/*******************************************************************************************************************************************************************/
+/* Declaration and Initialization */
+
+static u8  u8_gs_useBusyFlag = 0;				//Busy Flag is polled, set once the interface is set ( Function Set ), cleared if it never clears
+static u32 u32_gs_writeTime = 0;				//SWT us time of the last instruction
+static u16 u16_gs_executionTimeUS = 0;			//Execution time of the last instruction, waited in fixed_delay mode
+
+#if Write_Mode == queued
+static volatile u16 au16_gs_queue[LCD_Queue_Size];	//Queued bytes, bit 8 is RS ( Command or Data register )
+static volatile u8 u8_gs_queueHead = 0;			//Next free entry, moved by the API ( caller ) only
+static volatile u8 u8_gs_queueTail = 0;			//Next entry to write, moved by LCD_drainQueue ( tick ISR ) only
+static u8  u8_gs_queueRunning = 0;				//API calls are queued, set once LCD_init started the drain Timer
+#endif
+static u8  aau8_gs_frame[LCD_Rows][LCD_Columns];	//Shadow Frame, written by the API
+static u8  aau8_gs_shown[LCD_Rows][LCD_Columns];	//Frame shown on LCD, after the last flush
+static const u8 Au8_gs_rowAddress[4] = { 0x00, 0x40, LCD_Columns, 0x40 + LCD_Columns };	//DDRAM address of each Row start
+
+static const u16 Au16_gs_powersOfTen[4] = { 10000, 1000, 100, 10 };	//Subtracted to get each digit, no division
+
+static u16 u16_gs_queueDrops = 0;				//Bytes dropped on a full queue
+static u8  u8_gs_queueHighWaterMark = 0;		//Max. number of bytes waiting in the queue
+
+/*******************************************************************************************************************************************************************/
+/* LCD Private Functions' Prototypes */
+
+static void LCD_write ( u8 u8_a_data, EN_DIO_PinValue en_a_registerSelect );
+static u8   LCD_isReady ( void );
+static void LCD_waitReady ( void );
+static void LCD_formatFloat ( f32 f32_a_floatValue, u8 *pu8_a_string );
+static void LCD_formatNumber ( u16 u16_a_value, u8 u8_a_decimals, u8 u8_a_width, u8 *pu8_a_string );
+static u8   LCD_getQueueSpace ( void );
+static void LCD_resetFrame ( void );
+#if Write_Mode == queued
+static void LCD_enqueue ( u8 u8_a_data, EN_DIO_PinValue en_a_registerSelect );
+static void LCD_drainQueue ( void );
+#endif
+static void LCD_pulseEnable ( void );
+
 /*******************************************************************************************************************************************************************/
 /*
  Name: LCD_init
@@ -21,6 +67,11 @@
 */
 void LCD_init ( void )
 {	
+	u8_gs_useBusyFlag = 0;						//Busy Flag can not be checked before Function Set
+	#if Write_Mode == queued
+	u8_gs_queueRunning = 0;						//initialization is written directly
+	#endif
+	
 	#if Mode == bit_8							//if LCD mode chosen in 8bit mode
 	DIO_init (LCD_Data_Port, D7 ,OUT);			//make data7 pin output
 	DIO_init (LCD_Data_Port, D6 ,OUT);			//make data6 pin output
@@ -34,12 +85,8 @@ void LCD_init ( void )
 	DIO_init (LCD_cmmnd_Port, RW ,OUT);			//make Rw pin output
 	DIO_init (LCD_cmmnd_Port, RS ,OUT);			//make Rs pin output
 	//_delay_ms(20);							//LCD power on delay is always more than 15ms
-	TMR0_delayMS(20);
+	SWT_delayMS(20);
 	LCD_sendCommand(0x38);						//initialization LCD 16x2 in 8bit mode
-	LCD_sendCommand(0x0C);						//display on cursor off
-	LCD_sendCommand(0x06);						//auto increment cursor
-	LCD_sendCommand(0x01);						//clear display
-	LCD_sendCommand(0x80);						//cursor at home position
 	#elif Mode == bit_4							//if LCD mode chosen in 4bit mode
 	DIO_init (LCD_Data_cmmnd_Port, D7 ,OUT);	//make data7 pin output
 	DIO_init (LCD_Data_cmmnd_Port, D6 ,OUT);	//make data6 pin output
@@ -49,13 +96,28 @@ void LCD_init ( void )
 	DIO_init (LCD_Data_cmmnd_Port, RW ,OUT);	//make rw pin output
 	DIO_init (LCD_Data_cmmnd_Port, RS ,OUT);	//make rs pin output
 	//_delay_ms(20);							//LCD power on delay is always more than 15ms
-	TMR0_delayMS(20);
+	SWT_delayMS(20);
 	LCD_sendCommand(0x02);						//initialization LCD in 4bit mode
 	LCD_sendCommand(0x28);						//2 lines, 8x5 pixels in 4bit mode
+	#endif
+	#if Wait_Mode == busy_flag					//if Busy Flag is chosen
+	u8_gs_useBusyFlag = 1;						//interface is set, Busy Flag is valid from now on
+	#endif
 	LCD_sendCommand(0x0C);						//display on cursor off
 	LCD_sendCommand(0x06);						//auto increment cursor
 	LCD_sendCommand(0x01);						//clear display
 	LCD_sendCommand(0x80);						//cursor at home position
+	LCD_clearFrame();							//Frame and LCD are blank
+	LCD_resetFrame();
+	#if Write_Mode == queued					//if queued write mode chosen
+	u8 u8_l_timerId;
+	u8_gs_queueHead = 0;
+	u8_gs_queueTail = 0;
+	if (SWT_createTimer(&u8_l_timerId) == STD_TYPES_OK)
+	{
+		SWT_startTimer(u8_l_timerId, LCD_Drain_Period_MS, SWT_U8_MODE_PERIODIC, LCD_drainQueue);
+		u8_gs_queueRunning = 1;					//from now on API calls are queued, no free Timer keeps them blocking
+	}
 	#endif
 }
 
@@ -68,36 +130,17 @@ void LCD_init ( void )
 */
 void LCD_sendCommand ( u8 u8_a_cmnd )
 {
-	#if Mode == bit_8									//if LCD mode chosen in 8bit mode
-	DIO_setPortValue(LCD_Data_Port,u8_a_cmnd);			//LCD Data Port = u8_a_cmnd
-	DIO_write (LCD_cmmnd_Port, RS, LOW);				//RS = 0 Command register
-	DIO_write (LCD_cmmnd_Port, RW, LOW);				//RW = 0 write operation
-	DIO_write (LCD_cmmnd_Port, EN, HIGH);				//EN = 1 high pulse
-	//_delay_us(1);										//delay 1us is always more than 450ns
-	TMR0_delayMS(1);
-	DIO_write (LCD_cmmnd_Port, EN, LOW);				//EN = 0 low pulse
-	//_delay_ms(3);										//delay 3ms
-	TMR0_delayMS(3);
-	#elif Mode == bit_4									//if LCD mode chosen in 4bit mode
-	DIO_setHigherNibble(LCD_Data_cmmnd_Port, u8_a_cmnd);//Sending upper nipple of u8_a_cmnd to LCD Data Port
-	DIO_write (LCD_Data_cmmnd_Port, RS ,LOW);			//RS = 0 Command register
-	DIO_write (LCD_Data_cmmnd_Port, RW, LOW);			//RW = 0 write operation
-	DIO_write (LCD_Data_cmmnd_Port, EN, HIGH);			//EN = 1 high pulse
-	//_delay_us(1);										//delay 1us is always more than 450ns
-	TMR0_delayMS(1);
-	DIO_write (LCD_Data_cmmnd_Port, EN ,LOW);			//EN = 0 low pulse
-	//_delay_ms(2);										//delay 2ms
-	TMR0_delayMS(2);
-	DIO_setLowerNibble(LCD_Data_cmmnd_Port , u8_a_cmnd);//Sending lower nipple of u8_a_cmnd to LCD Data Port
-	DIO_write (LCD_Data_cmmnd_Port, RS ,LOW);			//RS = 0 Command register
-	DIO_write (LCD_Data_cmmnd_Port, RW ,LOW);			//RW = 0 write operation
-	DIO_write (LCD_Data_cmmnd_Port, EN ,HIGH);			//EN = 1 high pulse
-	//_delay_us(1);										//delay 1us is always more than 450ns
-	TMR0_delayMS(1);
-	DIO_write (LCD_Data_cmmnd_Port, EN ,LOW);			//EN = 0 low pulse
-	//_delay_ms(3);										//delay 3ms
-	TMR0_delayMS(3);
+	#if Write_Mode == queued							//if queued write mode chosen
+	if (u8_gs_queueRunning)
+	{
+		LCD_enqueue(u8_a_cmnd, LOW);					//RS = 0 Command register, written later from the tick
+	}
+	else
 	#endif
+	{
+		LCD_waitReady();								//wait for the previous instruction, not after this one
+		LCD_write(u8_a_cmnd, LOW);						//RS = 0 Command register
+	}
 }
 
 /*******************************************************************************************************************************************************************/
@@ -109,36 +152,17 @@ void LCD_sendCommand ( u8 u8_a_cmnd )
 */
 void LCD_sendCharacter ( u8 u8_a_char )
 {
-	#if Mode == bit_8									//if LCD mode chosen in 8bit mode
-	DIO_setPortValue(LCD_Data_Port,u8_a_char);			//LCD Data Port = char data
-	DIO_write (LCD_cmmnd_Port, RS ,HIGH);				//RS = 1 Data register
-	DIO_write (LCD_cmmnd_Port, RW ,LOW);				//RW = 0 write operation
-	DIO_write (LCD_cmmnd_Port, EN ,HIGH);				//EN = 1 high pulse
-	//_delay_us(1);										//delay 1us is always more than 450ns
-	TMR0_delayMS(1);
-	DIO_write (LCD_cmmnd_Port, EN ,LOW);				//EN = 0 low pulse
-	//_delay_ms(1);										//delay 1ms
-	TMR0_delayMS(1);
-	#elif Mode == bit_4									//if LCD mode chosen in 4bit mode
-	DIO_setHigherNibble(LCD_Data_cmmnd_Port, u8_a_char);//Sending upper nipple of char data to LCD Data Port
-	DIO_write (LCD_Data_cmmnd_Port, RS ,HIGH);			//RS = 1 Data register
-	DIO_write (LCD_Data_cmmnd_Port, RW ,LOW);			//RW = 0 write operation
-	DIO_write (LCD_Data_cmmnd_Port, EN ,HIGH);			//EN = 1 high pulse
-	//_delay_us(1);										//delay 1us is always more than 450ns
-	TMR0_delayMS(1);
-	DIO_write (LCD_Data_cmmnd_Port, EN ,LOW);			//EN = 0 low pulse
-	//_delay_ms(2);										//delay 2ms
-	TMR0_delayMS(2);
-	DIO_setLowerNibble(LCD_Data_cmmnd_Port, u8_a_char);	//Sending lower nipple of char data to LCD Data Port
-	DIO_write (LCD_Data_cmmnd_Port, RS ,HIGH);			//RS = 1 Data register
-	DIO_write (LCD_Data_cmmnd_Port, RW ,LOW);			//RW = 0 write operation
-	DIO_write (LCD_Data_cmmnd_Port, EN ,HIGH);			//EN = 1 high pulse
-	//_delay_us(1);										//delay 1us is always more than 450ns
-	TMR0_delayMS(1);
-	DIO_write (LCD_Data_cmmnd_Port, EN ,LOW);			//EN = 0 low pulse
-	//_delay_ms(2);										//delay 2ms
-	TMR0_delayMS(2);
+	#if Write_Mode == queued							//if queued write mode chosen
+	if (u8_gs_queueRunning)
+	{
+		LCD_enqueue(u8_a_char, HIGH);					//RS = 1 Data register, written later from the tick
+	}
+	else
 	#endif
+	{
+		LCD_waitReady();								//wait for the previous instruction, not after this one
+		LCD_write(u8_a_char, HIGH);						//RS = 1 Data register
+	}
 }
 
 /*******************************************************************************************************************************************************************/
@@ -150,12 +174,10 @@ void LCD_sendCharacter ( u8 u8_a_char )
 */
 void LCD_clear ( void )
 {
-	/* Step 1: Send Display Clear control command */
+	/* Step 1: Send Display Clear control command, the next instruction waits its 1.53 ms */
 	LCD_sendCommand(0x01);					//clear display
-	/* Step 2: Delay more than 1.53 ms */
-	//_delay_ms(2);							//delay 2ms
-	TMR0_delayMS(2);
 	LCD_sendCommand(0x80);					//cursor at home position
+	LCD_resetFrame();						//LCD shows spaces now
 }
 
 /*******************************************************************************************************************************************************************/
@@ -199,48 +221,557 @@ void LCD_sendString ( u8 *pu8_a_string )
 */
 void LCD_floatToString (f32 f32_a_floatValue)
 {
-	u8 u8_l_pattern[10] , u8_l_tempRearrange, u8_l_digitCount=0,i,j;
+	u8 u8_l_pattern[10];
+	LCD_formatFloat( f32_a_floatValue, u8_l_pattern );
+	LCD_sendString( u8_l_pattern );
+}
+
+/*******************************************************************************************************************************************************************/
+/*
+ Name: LCD_sendUnsigned
+ Input: u16 Value
+ Output: void
+ Description: Function to send an unsigned number to LCD through Data pins (From CGROM to DDRAM).
+*/
+void LCD_sendUnsigned ( u16 u16_a_value )
+{
+	u8 u8_l_pattern[LCD_Columns + 1];
+	LCD_formatNumber( u16_a_value, 0, 0, u8_l_pattern );
+	LCD_sendString( u8_l_pattern );
+}
+
+/*******************************************************************************************************************************************************************/
+/*
+ Name: LCD_sendFixedPoint
+ Input: u16 Value and u8 Decimals
+ Output: void
+ Description: Function to send a fixed point number ( Value / 10^Decimals, Decimals max. 4 ) to LCD through Data pins (From CGROM to DDRAM), i.e. 253 and 1 is "25.3".
+*/
+void LCD_sendFixedPoint ( u16 u16_a_value, u8 u8_a_decimals )
+{
+	u8 u8_l_pattern[LCD_Columns + 1];
+	LCD_formatNumber( u16_a_value, u8_a_decimals, 0, u8_l_pattern );
+	LCD_sendString( u8_l_pattern );
+}
+
+/*******************************************************************************************************************************************************************/
+/*
+ Name: LCD_sendUnsignedAligned
+ Input: u16 Value and u8 Width
+ Output: void
+ Description: Function to send an unsigned number right aligned in Width characters ( padded with spaces, all '*' if it does not fit ).
+*/
+void LCD_sendUnsignedAligned ( u16 u16_a_value, u8 u8_a_width )
+{
+	u8 u8_l_pattern[LCD_Columns + 1];
+	LCD_formatNumber( u16_a_value, 0, u8_a_width, u8_l_pattern );
+	LCD_sendString( u8_l_pattern );
+}
+
+/*******************************************************************************************************************************************************************/
+/*
+ Name: LCD_sendFixedPointAligned
+ Input: u16 Value, u8 Decimals, and u8 Width
+ Output: void
+ Description: Function to send a fixed point number right aligned in Width characters ( padded with spaces, all '*' if it does not fit ).
+*/
+void LCD_sendFixedPointAligned ( u16 u16_a_value, u8 u8_a_decimals, u8 u8_a_width )
+{
+	u8 u8_l_pattern[LCD_Columns + 1];
+	LCD_formatNumber( u16_a_value, u8_a_decimals, u8_a_width, u8_l_pattern );
+	LCD_sendString( u8_l_pattern );
+}
+
+/*******************************************************************************************************************************************************************/
+/*
+ Name: LCD_createCustomCharacter
+ Input: Pointer to u8 Pattern and u8 Location
+ Output: void
+ Description: Function to send character (stored in array -Special Char- byte by byte) and store it in CGRAM, then display it on DDRAM (From CGRAM to DDRAM).
+*/
+void LCD_createCustomCharacter ( u8 *pu8_a_pattern, u8 u8_a_location )
+{
+	u8 i;
+	LCD_sendCommand(( 0x40 + (u8_a_location*8)));
+	
+	for(i = 0; i<8; i++)
+	{
+		LCD_sendCharacter( pu8_a_pattern[i] );
+	}
+}
+
+/*******************************************************************************************************************************************************************/
+/*
+ Name: LCD_clearFrame
+ Input: void
+ Output: void
+ Description: Function to fill the shadow Frame with spaces, LCD is cleared on the next LCD_flushFrame.
+*/
+void LCD_clearFrame ( void )
+{
+	u8 u8_l_row, u8_l_column;
+	
+	for (u8_l_row = 0; u8_l_row < LCD_Rows; u8_l_row++)
+	{
+		for (u8_l_column = 0; u8_l_column < LCD_Columns; u8_l_column++)
+		{
+			aau8_gs_frame[u8_l_row][u8_l_column] = ' ';
+		}
+	}
+}
+
+/*******************************************************************************************************************************************************************/
+/*
+ Name: LCD_writeFrameCharacter
+ Input: u8 Row, u8 Column, and u8 Char
+ Output: void
+ Description: Function to write a Character in the shadow Frame ( outside the Frame is ignored ), LCD is updated on the next LCD_flushFrame.
+*/
+void LCD_writeFrameCharacter ( u8 u8_a_row, u8 u8_a_column, u8 u8_a_char )
+{
+	if (u8_a_row < LCD_Rows && u8_a_column < LCD_Columns)
+	{
+		aau8_gs_frame[u8_a_row][u8_a_column] = u8_a_char;
+	}
+}
+
+/*******************************************************************************************************************************************************************/
+/*
+ Name: LCD_writeFrameString
+ Input: u8 Row, u8 Column, and Pointer to u8 String
+ Output: void
+ Description: Function to write a String in the shadow Frame from Row and Column, clipped at the end of Row.
+*/
+void LCD_writeFrameString ( u8 u8_a_row, u8 u8_a_column, u8 *pu8_a_string )
+{
+	u8 i;
+	
+	for (i = 0; pu8_a_string[i] != '\0' && (u8_a_column + i) < LCD_Columns; i++)
+	{
+		LCD_writeFrameCharacter(u8_a_row, u8_a_column + i, pu8_a_string[i]);
+	}
+}
+
+/*******************************************************************************************************************************************************************/
+/*
+ Name: LCD_writeFrameFloat
+ Input: u8 Row, u8 Column, and f32 FloatValue
+ Output: void
+ Description: Function to write a float (one decimal) number in the shadow Frame from Row and Column, clipped at the end of Row.
+*/
+void LCD_writeFrameFloat ( u8 u8_a_row, u8 u8_a_column, f32 f32_a_floatValue )
+{
+	u8 u8_l_pattern[10];
+	LCD_formatFloat( f32_a_floatValue, u8_l_pattern );
+	LCD_writeFrameString( u8_a_row, u8_a_column, u8_l_pattern );
+}
+
+/*******************************************************************************************************************************************************************/
+/*
+ Name: LCD_writeFrameUnsigned
+ Input: u8 Row, u8 Column, u16 Value, and u8 Width
+ Output: void
+ Description: Function to write an unsigned number in the shadow Frame from Row and Column, right aligned in Width characters ( 0: no padding ).
+*/
+void LCD_writeFrameUnsigned ( u8 u8_a_row, u8 u8_a_column, u16 u16_a_value, u8 u8_a_width )
+{
+	u8 u8_l_pattern[LCD_Columns + 1];
+	LCD_formatNumber( u16_a_value, 0, u8_a_width, u8_l_pattern );
+	LCD_writeFrameString( u8_a_row, u8_a_column, u8_l_pattern );
+}
+
+/*******************************************************************************************************************************************************************/
+/*
+ Name: LCD_writeFrameFixedPoint
+ Input: u8 Row, u8 Column, u16 Value, u8 Decimals, and u8 Width
+ Output: void
+ Description: Function to write a fixed point number in the shadow Frame from Row and Column, right aligned in Width characters ( 0: no padding ).
+*/
+void LCD_writeFrameFixedPoint ( u8 u8_a_row, u8 u8_a_column, u16 u16_a_value, u8 u8_a_decimals, u8 u8_a_width )
+{
+	u8 u8_l_pattern[LCD_Columns + 1];
+	LCD_formatNumber( u16_a_value, u8_a_decimals, u8_a_width, u8_l_pattern );
+	LCD_writeFrameString( u8_a_row, u8_a_column, u8_l_pattern );
+}
+
+/*******************************************************************************************************************************************************************/
+/*
+ Name: LCD_flushFrame
+ Input: void
+ Output: u8 Number of bytes ( instructions and data ) sent to LCD
+ Description: Function to send the cells of the shadow Frame that differ from LCD, each run of changed cells is one cursor set plus its data,
+			  the cursor set is skipped when the run follows the previous one, a run that does not fit in the LCD queue waits for the next flush.
+*/
+u8 LCD_flushFrame ( void )
+{
+	u8 u8_l_bytes = 0, u8_l_row, u8_l_column, u8_l_runEnd, u8_l_address;
+	u8 u8_l_cursor = 0xFF;								//LCD Address Counter is unknown
+	u8 u8_l_queueFull = 0;
+	
+	for (u8_l_row = 0; u8_l_row < LCD_Rows && !u8_l_queueFull; u8_l_row++)
+	{
+		u8_l_column = 0;
+		
+		while (u8_l_column < LCD_Columns && !u8_l_queueFull)
+		{
+			/* Step 1: Find the run of changed cells from Column */
+			u8_l_runEnd = u8_l_column;
+			
+			while (u8_l_runEnd < LCD_Columns && aau8_gs_frame[u8_l_row][u8_l_runEnd] != aau8_gs_shown[u8_l_row][u8_l_runEnd])
+			{
+				u8_l_runEnd++;
+			}
+			
+			if (u8_l_runEnd == u8_l_column)
+			{
+				u8_l_column++;							//cell is not changed
+			}
+			else if ((u8_l_runEnd - u8_l_column) + (u8_l_cursor != Au8_gs_rowAddress[u8_l_row] + u8_l_column) > LCD_getQueueSpace())
+			{
+				u8_l_queueFull = 1;						//rest of the Frame stays changed, sent by the next flush
+			}
+			else
+			{
+				/* Step 2: Set cursor, unless LCD Address Counter is already at the run */
+				u8_l_address = Au8_gs_rowAddress[u8_l_row] + u8_l_column;
+				
+				if (u8_l_cursor != u8_l_address)
+				{
+					LCD_sendCommand(0x80 | u8_l_address);	//Set DDRAM address
+					u8_l_bytes++;
+				}
+				
+				/* Step 3: Send the run, LCD Address Counter auto increments */
+				for (; u8_l_column < u8_l_runEnd; u8_l_column++)
+				{
+					LCD_sendCharacter(aau8_gs_frame[u8_l_row][u8_l_column]);
+					aau8_gs_shown[u8_l_row][u8_l_column] = aau8_gs_frame[u8_l_row][u8_l_column];
+					u8_l_bytes++;
+				}
+				
+				u8_l_cursor = Au8_gs_rowAddress[u8_l_row] + u8_l_runEnd;
+			}
+		}
+	}
+	
+	return u8_l_bytes;
+}
+
+/*******************************************************************************************************************************************************************/
+/*
+ Name: LCD_getQueueStatistics
+ Input: Pointer to u16 ReturnedDrops and Pointer to u8 ReturnedHighWaterMark
+ Output: void
+ Description: Function to get the number of bytes dropped on a full queue, and the max. number of bytes that waited in the queue ( both 0 in blocking mode ).
+*/
+void LCD_getQueueStatistics ( u16 *pu16_a_returnedDrops, u8 *pu8_a_returnedHighWaterMark )
+{
+	if (pu16_a_returnedDrops != NULL && pu8_a_returnedHighWaterMark != NULL)
+	{
+		*pu16_a_returnedDrops = u16_gs_queueDrops;
+		*pu8_a_returnedHighWaterMark = u8_gs_queueHighWaterMark;
+	}
+}
+
+/*******************************************************************************************************************************************************************/
+/*
+ Name: LCD_write
+ Input: u8 Data and en RegisterSelect
+ Output: void
+ Description: Function to write an instruction ( RS = LOW ) or data ( RS = HIGH ) through Data pins, LCD must be ready.
+*/
+static void LCD_write ( u8 u8_a_data, EN_DIO_PinValue en_a_registerSelect )
+{
+	#if Mode == bit_8									//if LCD mode chosen in 8bit mode
+	DIO_setPortValue(LCD_Data_Port,u8_a_data);			//LCD Data Port = u8_a_data
+	DIO_write (LCD_cmmnd_Port, RS, en_a_registerSelect);//RS = Command or Data register
+	DIO_write (LCD_cmmnd_Port, RW, LOW);				//RW = 0 write operation
+	LCD_pulseEnable();
+	#elif Mode == bit_4									//if LCD mode chosen in 4bit mode
+	DIO_setHigherNibble(LCD_Data_cmmnd_Port, u8_a_data);//Sending upper nipple of u8_a_data to LCD Data Port
+	DIO_write (LCD_Data_cmmnd_Port, RS, en_a_registerSelect);//RS = Command or Data register
+	DIO_write (LCD_Data_cmmnd_Port, RW, LOW);			//RW = 0 write operation
+	LCD_pulseEnable();
+	DIO_setLowerNibble(LCD_Data_cmmnd_Port, u8_a_data);	//Sending lower nipple of u8_a_data to LCD Data Port
+	LCD_pulseEnable();
+	#endif
+	
+	/* Clear Display ( 0x01 ) and Return Home ( 0x02, 0x03 ) take 1.53 ms, all other instructions 37 us */
+	u16_gs_executionTimeUS = ( ( en_a_registerSelect == LOW ) && ( u8_a_data < 0x04 ) ) ? LCD_Clear_Time_US : LCD_Command_Time_US;
+	u32_gs_writeTime = SWT_getMicros();
+}
+
+/*******************************************************************************************************************************************************************/
+/*
+ Name: LCD_isReady
+ Input: void
+ Output: u8 TRUE if LCD executed the last instruction, FALSE if it is busy
+ Description: Function to check once ( without waiting ) if LCD is ready, by reading the Busy Flag, or by the elapsed execution time.
+*/
+static u8 LCD_isReady ( void )
+{
+	u8 u8_l_busyFlag = LOW;
+	
+	if (u8_gs_useBusyFlag)
+	{
+		#if Mode == bit_8								//if LCD mode chosen in 8bit mode
+		DIO_setPortDirection(LCD_Data_Port, 0x00);		//Data pins input, before LCD drives them
+		DIO_write (LCD_cmmnd_Port, RS, LOW);			//RS = 0, RW = 1 read Busy Flag and Address
+		DIO_write (LCD_cmmnd_Port, RW, HIGH);
+		DIO_write (LCD_cmmnd_Port, EN, HIGH);			//D7 is valid 360 ns after EN rises, less than one DIO call
+		DIO_read (LCD_Data_Port, D7, &u8_l_busyFlag);
+		DIO_write (LCD_cmmnd_Port, EN, LOW);
+		DIO_write (LCD_cmmnd_Port, RW, LOW);			//RW = 0, LCD releases Data pins
+		DIO_setPortDirection(LCD_Data_Port, 0xFF);		//Data pins output again
+		#elif Mode == bit_4								//if LCD mode chosen in 4bit mode
+		DIO_init (LCD_Data_cmmnd_Port, D7 ,IN);			//Data pins input, before LCD drives them
+		DIO_init (LCD_Data_cmmnd_Port, D6 ,IN);
+		DIO_init (LCD_Data_cmmnd_Port, D5 ,IN);
+		DIO_init (LCD_Data_cmmnd_Port, D4 ,IN);
+		DIO_write (LCD_Data_cmmnd_Port, RS, LOW);		//RS = 0, RW = 1 read Busy Flag and Address
+		DIO_write (LCD_Data_cmmnd_Port, RW, HIGH);
+		DIO_write (LCD_Data_cmmnd_Port, EN, HIGH);		//upper nibble, D7 is valid 360 ns after EN rises, less than one DIO call
+		DIO_read (LCD_Data_cmmnd_Port, D7, &u8_l_busyFlag);
+		DIO_write (LCD_Data_cmmnd_Port, EN, LOW);
+		LCD_pulseEnable();								//lower nibble ( Address Counter ), not used
+		DIO_write (LCD_Data_cmmnd_Port, RW, LOW);		//RW = 0, LCD releases Data pins
+		DIO_init (LCD_Data_cmmnd_Port, D7 ,OUT);		//Data pins output again
+		DIO_init (LCD_Data_cmmnd_Port, D6 ,OUT);
+		DIO_init (LCD_Data_cmmnd_Port, D5 ,OUT);
+		DIO_init (LCD_Data_cmmnd_Port, D4 ,OUT);
+		#endif
+		
+		if ( ( u8_l_busyFlag == HIGH ) && ( ( SWT_getMicros() - u32_gs_writeTime ) > LCD_Busy_Timeout_US ) )
+		{
+			u8_gs_useBusyFlag = 0;						//Busy Flag never cleared ( RW not wired ), fall back to fixed delays
+			u8_l_busyFlag = LOW;						//longest instruction is over anyway
+		}
+	}
+	else if ( ( SWT_getMicros() - u32_gs_writeTime ) <= u16_gs_executionTimeUS )
+	{
+		u8_l_busyFlag = HIGH;							//last instruction execution time is not over
+	}
+	
+	return ( u8_l_busyFlag == LOW ) ? TRUE : FALSE;
+}
+
+/*******************************************************************************************************************************************************************/
+/*
+ Name: LCD_waitReady
+ Input: void
+ Output: void
+ Description: Function to wait until LCD executed the last instruction.
+*/
+static void LCD_waitReady ( void )
+{
+	while ( LCD_isReady() == FALSE );
+}
+
+/*******************************************************************************************************************************************************************/
+/*
+ Name: LCD_pulseEnable
+ Input: void
+ Output: void
+ Description: Function to latch Data pins into LCD, EN is HIGH for one DIO call ( about 2 us at 8 MHz, 450 ns min. ).
+*/
+static void LCD_pulseEnable ( void )
+{
+	#if Mode == bit_8
+	DIO_write (LCD_cmmnd_Port, EN, HIGH);				//EN = 1 high pulse
+	DIO_write (LCD_cmmnd_Port, EN, LOW);				//EN = 0 low pulse, data is latched on the falling edge
+	#elif Mode == bit_4
+	DIO_write (LCD_Data_cmmnd_Port, EN, HIGH);			//EN = 1 high pulse
+	DIO_write (LCD_Data_cmmnd_Port, EN, LOW);			//EN = 0 low pulse, data is latched on the falling edge
+	#endif
+}
+
+/*******************************************************************************************************************************************************************/
+#if Write_Mode == queued
+/*
+ Name: LCD_enqueue
+ Input: u8 Data and en RegisterSelect
+ Output: void
+ Description: Function to queue an instruction or data byte, dropped ( and counted ) if the queue is full.
+*/
+static void LCD_enqueue ( u8 u8_a_data, EN_DIO_PinValue en_a_registerSelect )
+{
+	u8 u8_l_nextHead = (u8_gs_queueHead + 1) & (LCD_Queue_Size - 1);
+	u8 u8_l_queuedBytes;
+	
+	if (u8_l_nextHead == u8_gs_queueTail)
+	{
+		u16_gs_queueDrops++;							//queue is full, byte is dropped
+	}
+	else
+	{
+		au16_gs_queue[u8_gs_queueHead] = ((u16)en_a_registerSelect << 8) | u8_a_data;
+		u8_gs_queueHead = u8_l_nextHead;				//entry is visible to the drain once it is written
+		
+		u8_l_queuedBytes = (u8_gs_queueHead - u8_gs_queueTail) & (LCD_Queue_Size - 1);
+		if (u8_l_queuedBytes > u8_gs_queueHighWaterMark)
+		{
+			u8_gs_queueHighWaterMark = u8_l_queuedBytes;
+		}
+	}
+}
+
+/*******************************************************************************************************************************************************************/
+/*
+ Name: LCD_drainQueue
+ Input: void
+ Output: void
+ Description: Function to write the next queued byte once LCD is ready ( called back from the system tick ISR every LCD_Drain_Period_MS ).
+*/
+static void LCD_drainQueue ( void )
+{
+	u16 u16_l_entry;
+	
+	if ((u8_gs_queueTail != u8_gs_queueHead) && (LCD_isReady() == TRUE))
+	{
+		u16_l_entry = au16_gs_queue[u8_gs_queueTail];
+		LCD_write((u8)u16_l_entry, (u16_l_entry >> 8) ? HIGH : LOW);
+		u8_gs_queueTail = (u8_gs_queueTail + 1) & (LCD_Queue_Size - 1);	//entry is free once it is written
+	}
+}
+
+/*******************************************************************************************************************************************************************/
+#endif
+/*
+ Name: LCD_formatFloat
+ Input: f32 FloatValue and Pointer to u8 String ( 10 bytes )
+ Output: void
+ Description: Function to format a float (one decimal) number into String.
+*/
+static void LCD_formatFloat ( f32 f32_a_floatValue, u8 *pu8_a_string )
+{
+	u8 u8_l_tempRearrange, u8_l_digitCount=0,i,j;
 	u32 u32_l_number;
 	f32 temp_float = f32_a_floatValue * 10;
 	u32_l_number = temp_float;
 	
-	for (i=0;u32_l_number>0;i++)
+	for (i=0;u32_l_number>0 || i<2;i++)				//at least 2 digits, 0 is "0.0" and 0.5 is "0.5"
 	{
-		u8_l_pattern[i] = ((u32_l_number%10) +'0');
+		pu8_a_string[i] = ((u32_l_number%10) +'0');
 		u32_l_number/=10;
 		u8_l_digitCount++;
 	}
 	
 	for (j=0,i--;i>j;j++)
 	{
-		u8_l_tempRearrange = u8_l_pattern[i];
-		u8_l_pattern[i] = u8_l_pattern[j];
-		u8_l_pattern[j] = u8_l_tempRearrange;
+		u8_l_tempRearrange = pu8_a_string[i];
+		pu8_a_string[i] = pu8_a_string[j];
+		pu8_a_string[j] = u8_l_tempRearrange;
 		i--;
 	}
 	
-	u8_l_pattern[u8_l_digitCount] =u8_l_pattern[u8_l_digitCount - 1];
-	u8_l_pattern[u8_l_digitCount - 1] = '.';
-	u8_l_pattern[u8_l_digitCount + 1] = '\0';
-	LCD_sendString( u8_l_pattern );
+	pu8_a_string[u8_l_digitCount] =pu8_a_string[u8_l_digitCount - 1];
+	pu8_a_string[u8_l_digitCount - 1] = '.';
+	pu8_a_string[u8_l_digitCount + 1] = '\0';
 }
 
 /*******************************************************************************************************************************************************************/
 /*
- Name: LCD_createCustomCharacter
- Input: Pointer to u8 Pattern and u8 Location
+ Name: LCD_formatNumber
+ Input: u16 Value, u8 Decimals ( max. 4 ), u8 Width ( 0: no padding, max. LCD_Columns ), and Pointer to u8 String ( LCD_Columns + 1 bytes )
  Output: void
- Description: Function to send character (stored in array -Special Char- byte by byte) and store it in CGRAM, then display it on DDRAM (From CGRAM to DDRAM).
+ Description: Function to format a fixed point number ( Value / 10^Decimals ) into String, right aligned in Width characters.
+			  Digits are found by subtracting powers of ten ( max. 9 per digit ), AVR has no divide instruction and u16 division is a library loop.
 */
-void LCD_createCustomCharacter ( u8 *pu8_a_pattern, u8 u8_a_location )
+static void LCD_formatNumber ( u16 u16_a_value, u8 u8_a_decimals, u8 u8_a_width, u8 *pu8_a_string )
 {
-	u8 i;
-	LCD_sendCommand(( 0x40 + (u8_a_location*8)));
+	u8 au8_l_digits[5], u8_l_first, u8_l_length, u8_l_index = 0, i;
 	
-	for(i = 0; i<8; i++)
+	if (u8_a_decimals > 4) u8_a_decimals = 4;
+	if (u8_a_width > LCD_Columns) u8_a_width = LCD_Columns;
+	
+	/* Step 1: Extract the 5 digits, most significant first */
+	for (i = 0; i < 4; i++)
 	{
-		LCD_sendCharacter( pu8_a_pattern[i] );
+		au8_l_digits[i] = '0';
+		
+		while (u16_a_value >= Au16_gs_powersOfTen[i])
+		{
+			u16_a_value -= Au16_gs_powersOfTen[i];
+			au8_l_digits[i]++;
+		}
+	}
+	
+	au8_l_digits[4] = u16_a_value + '0';
+	
+	/* Step 2: Skip leading zeros, keep the units digit and the decimals */
+	for (u8_l_first = 0; u8_l_first < (4 - u8_a_decimals) && au8_l_digits[u8_l_first] == '0'; u8_l_first++);
+	
+	u8_l_length = (5 - u8_l_first) + (u8_a_decimals != 0);
+	
+	/* Check 1: Number does not fit in Width */
+	if (u8_a_width != 0 && u8_l_length > u8_a_width)
+	{
+		while (u8_l_index < u8_a_width)
+		{
+			pu8_a_string[u8_l_index++] = '*';
+		}
+	}
+	/* Check 2: Number fits */
+	else
+	{
+		while ((u8_l_index + u8_l_length) < u8_a_width)
+		{
+			pu8_a_string[u8_l_index++] = ' ';			//right align
+		}
+		
+		for (i = u8_l_first; i < 5; i++)
+		{
+			if (u8_a_decimals != 0 && i == (5 - u8_a_decimals))
+			{
+				pu8_a_string[u8_l_index++] = '.';
+			}
+			
+			pu8_a_string[u8_l_index++] = au8_l_digits[i];
+		}
+	}
+	
+	pu8_a_string[u8_l_index] = '\0';
+}
+
+/*******************************************************************************************************************************************************************/
+/*
+ Name: LCD_getQueueSpace
+ Input: void
+ Output: u8 Number of bytes that can be queued without a drop ( 255 if API calls are not queued )
+ Description: Function to get the free space of the LCD queue.
+*/
+static u8 LCD_getQueueSpace ( void )
+{
+	u8 u8_l_space = 0xFF;
+	
+	#if Write_Mode == queued
+	if (u8_gs_queueRunning)
+	{
+		u8_l_space = (LCD_Queue_Size - 1) - ((u8_gs_queueHead - u8_gs_queueTail) & (LCD_Queue_Size - 1));
 	}
+	#endif
+	
+	return u8_l_space;
 }
 
-/*******************************************************************************************************************************************************************/
\ No newline at end of file
+/*******************************************************************************************************************************************************************/
+/*
+ Name: LCD_resetFrame
+ Input: void
+ Output: void
+ Description: Function to mark LCD as showing spaces ( after Display Clear ), the shadow Frame is kept and fully sent by the next flush.
+*/
+static void LCD_resetFrame ( void )
+{
+	u8 u8_l_row, u8_l_column;
+	
+	for (u8_l_row = 0; u8_l_row < LCD_Rows; u8_l_row++)
+	{
+		for (u8_l_column = 0; u8_l_column < LCD_Columns; u8_l_column++)
+		{
+			aau8_gs_shown[u8_l_row][u8_l_column] = ' ';
+		}
+	}
+}
+
+/*******************************************************************************************************************************************************************/
@@ -18,26 +18,110 @@
 /*============= MACRO DEFINITION =============*/
 #define HIGH 1
 #define LOW 0
+#define US_MAX_SENSORS			4		//max number of sensors handled by the driver
+#define US_ECHO_TIMEOUT_MS		30		//max time from trigger to echo falling edge (400 cm takes ~23.2 ms)
+#define US_MAX_DISTANCE_CM		400		//farther readings are reported as US_NO_ECHO
+#define US_US_PER_CM			58		//echo round trip time per cm
+#define US_TRIGGER_US			10		//trigger pulse width, timer1 counts 1 us (F_CPU_8)
+#define US_DEFAULT_GUARD_MS		10		//default quiet time between two measurements, lets late echoes of the previous burst fade out
+
+//distance filter: median of last US_MEDIAN_SIZE samples -> rate of change gate -> alpha beta smoother (fixed point, Q8)
+#define US_MEDIAN_SIZE			3		//odd window size [1,3,5]
+#define US_MAX_SPEED_CMS		300		//max relative speed (cm/s), faster changes are rejected as outliers
+#define US_GATE_MARGIN_CM		5		//distance change always accepted on top of the speed limit
+#define US_MAX_REJECTS			3		//consecutive rejected samples before the filter re-locks on new readings
+#define US_ALPHA_Q8				128		//position gain 0.5 (x/256)
+#define US_BETA_Q8				32		//velocity gain 0.125 (x/256)
+
+#if (US_MEDIAN_SIZE != 1) && (US_MEDIAN_SIZE != 3) && (US_MEDIAN_SIZE != 5)
+#error "US: US_MEDIAN_SIZE must be 1, 3 or 5"
+#endif
+
+/*============= TYPE DEFINITION =============*/
+typedef enum{
+	US_IDLE,		//no measurement started yet
+	US_BUSY,		//measurement in progress
+	US_OK,			//distance is valid
+	US_NO_ECHO,		//echo did not return before timeout, or obstacle is out of range
+	US_FAULT		//echo pulse never started, sensor is not responding
+}EN_US_status;
+
+typedef struct{
+	u16 distance;			//raw distance in cm, valid only with US_OK
+	u16 filteredDistance;	//filtered distance in cm, valid only with US_OK
+	s16 closingVelocity;	//estimated closing velocity in cm/s (positive when obstacle gets nearer), valid only with US_OK
+	EN_US_status status;	//status of the measurement, US_IDLE if no measurement completed yet
+	u32 timestamp;			//SWT uptime (ms) when the measurement completed
+}ST_US_Sample;
+
+typedef struct{
+	u8 triggerPort;				//trigger on OC1A (PD5) or OC1B (PD4, unless system tick is on timer1) is generated by timer1 hardware, else by software
+	u8 triggerPin;
+	EN_ICU_Source echoSource;	//sensors may share one echo channel (diode OR), as only one sensor is measured at a time
+}ST_US_ConfigType;
 
 /*============= FUNCTION PROTOTYPE =============*/
 
 /*
   Description : Function to initialize the ultrasonic driver
-  1-initialize ICU driver
+  1-initialize ICU channel of each distinct echo source
   2-set callback function
-  3-setup trigger pin direction as output
-  4-setup External interrupt source
+  3-setup trigger pins direction as output
+  4-reserve echo timeout and auto ranging software timers (SWT must be initialized)
  <Inputs>
-  u8 a_triggerPort:trigger port 
-  a_triggerPin:trigger pin
-  en_a_echoPin: interrupt source pin [EN_INT0,EN_INT1,EN_INT2]
+  a_sensors: table of a_count sensors, sensor id is its index in the table
+  echo source: [EN_INT0,EN_INT1,EN_INT2], or EN_ICP1 for hardware capture on PD6 (no ISR latency jitter)
+ */
+EN_state US_init(const ST_US_ConfigType *a_sensors,u8 a_count);
+
+/*
+  Description : Function to set function called back (from ISR) when a measurement of any sensor completes with any status
+ */
+EN_state US_setCallBack(void(*a_ptr)(void));
+
+/*
+  Description : Function to trigger a new measurement of one sensor and return immediately
+  return US_BUSY if a measurement of any sensor is still in progress (nothing started), else US_IDLE
+  not to be called from ISR
+ */
+EN_US_status US_startMeasurement(u8 a_sensor);
+
+/*
+  Description : Function to poll the last measurement of one sensor
+  return US_BUSY while any sensor is measuring, else status of the last measurement of the sensor
+  a_distance is updated only with US_OK
  */
-EN_state US_init(u8 a_triggerPort,u8 a_triggerPin,EN_ICU_Source en_a_echoPin);
+EN_US_status US_getDistance(u8 a_sensor,u16 *a_distance);
 
-// Description :function to read distance of from the sensor
-u16 US_readDistance(void);
+/*
+  Description : Function to measure all sensors round robin from ISR, one sensor at a time (no crosstalk)
+  next sensor is triggered a_guardMS after the previous echo completed, so the sample rate is as high as the distances allow
+  return invalid if a_guardMS is zero
+ */
+EN_state US_startAutoRanging(u16 a_guardMS);
+
+/*
+  Description : Function to stop auto ranging, a measurement in progress still completes
+ */
+void US_stopAutoRanging(void);
+
+/*
+  Description : Function to copy the latest completed measurement (auto or single) of one sensor without disabling interrupts
+ */
+EN_state US_readSample(u8 a_sensor,ST_US_Sample *a_sample);
+
+/*
+  Description : Function to get the aggregate sample rate of all sensors (samples completed during the last full second)
+ */
+u16 US_getSampleRate(void);
+
+/*
+  Description : function to read distance of one sensor, blocks up to US_ECHO_TIMEOUT_MS
+  return 0 if the measurement failed
+ */
+u16 US_readDistance(u8 a_sensor);
 
 
 
 
-#endif /* US_INTERFACE_H_ */
\ No newline at end of file
+#endif /* US_INTERFACE_H_ */
@@ -6,76 +6,409 @@
  */ 
 /*============= FILE INCLUSION =============*/
 #include "us_interface.h"
-#include "../../MCAL/tmr0/tmr0_interface.h"
+#include "../../LIB/swt/swt_interface.h"
+#include "../../MCAL/gli/gli_interface.h"
 /*============= MACRO DEFINITION =============*/
+#define RATE_WINDOW_MS		1000		//sample rate is counted over one second
+#define Q8_ONE				256			//fixed point one
+#define MAX_DT_MS			500			//longer gaps are clamped, keeps fixed point math in range
+#define MS_PER_S			1000
 
+/*============= TYPE DEFINITION =============*/
+typedef struct
+{
+	u16 window[US_MEDIAN_SIZE];		//last raw distances
+	u8 index;						//next window slot
+	u8 count;						//filled window slots
+	u8 locked;						//smoother has a valid state
+	u8 rejects;						//consecutive rejected samples
+	s32 position;					//smoothed distance (cm, Q8)
+	s32 velocity;					//smoothed rate of change of distance (cm/s, Q8), negative when closing
+	u32 lastTime;					//uptime (ms) of last accepted or coasted sample
+}ST_US_Filter;
 
 /*============= GLOBAL STATIC VARIABLES =============*/
-static u8 u8_g_edgeCount = 0;		//to count number of edges
-static u16 u16_g_timeHigh = 0;		//to hold time of generated pulse
-static u8 u8_g_triggerPort;			//to hold trigger port id
-static u8 u8_g_triggerPin;			//to hold trigger pin id
+static ST_US_ConfigType ST_g_sensors[US_MAX_SENSORS];	//to hold sensors configuration
+static u8 u8_g_sensorsCount=0;							//to hold number of sensors
+static volatile u8 u8_g_active=0;						//to hold sensor being measured
+static volatile u8 u8_g_edgeCount = 0;					//to count number of edges
+static volatile EN_US_status en_g_status = US_IDLE;		//to hold status of current or last measurement
+static u8 u8_g_timerId;									//to hold echo timeout timer id
+static u8 u8_g_autoTimerId;								//to hold auto ranging guard timer id
+static volatile u8 u8_g_autoRunning=0;					//set while auto ranging
+static volatile u16 u16_g_guardMS=US_DEFAULT_GUARD_MS;	//to hold quiet time between measurements
+static volatile ST_US_Sample ST_g_samples[US_MAX_SENSORS];	//latest published measurement of each sensor
+static volatile u8 u8_g_sampleSequence[US_MAX_SENSORS];	//odd while sample is being written (seqlock)
+static u16 u16_g_sampleCount=0;							//samples completed in current rate window
+static volatile u16 u16_g_sampleRate=0;					//samples completed in last rate window
+static u32 u32_g_rateWindowStart=0;						//uptime (ms) of current rate window start
+static ST_US_Filter ST_g_filters[US_MAX_SENSORS];		//distance filter state of each sensor (ISR only)
+static void (*g_callBackPtr)(void) = NULL;				//to hold measurement complete callback
 
-/*============= FUNCTION DEFINITION =============*/
+/*============= PRIVATE FUNCTIONS =============*/
+
+static void US_Trigger(void);
+static void US_echoTimeout(void);
+static void US_autoTrigger(void);
+
+//median of the filled part of the window, constant cost (window size is at most 5)
+static u16 US_median(const ST_US_Filter *filter)
+{
+	u16 sorted[US_MEDIAN_SIZE],value;
+	u8 i,j;
+	for(i=0;i<filter->count;i++)
+	{
+		value=filter->window[i];
+		for(j=i;j>0 && sorted[j-1]>value;j--)
+			sorted[j]=sorted[j-1];
+		sorted[j]=value;
+	}
+	return sorted[filter->count/2];
+}
+
+//run one raw distance through median -> gate -> alpha beta, fill filtered distance and closing velocity of the sample
+static void US_filter(ST_US_Filter *filter,u16 u16_a_distance,u32 u32_a_time,ST_US_Sample *sample)
+{
+	s32 measured,predicted,residual,step;
+	u32 dt;
+	//1-median
+	filter->window[filter->index]=u16_a_distance;
+	filter->index=(filter->index+1)%US_MEDIAN_SIZE;
+	if(filter->count < US_MEDIAN_SIZE)
+		filter->count++;
+	measured=(s32)US_median(filter)*Q8_ONE;
+	if(!filter->locked)
+	{
+		filter->position=measured;
+		filter->velocity=0;
+		filter->rejects=0;
+		filter->locked=1;
+	}
+	else
+	{
+		dt=u32_a_time-filter->lastTime;
+		if(dt == 0)
+			dt=1;
+		else if(dt > MAX_DT_MS)
+			dt=MAX_DT_MS;
+		predicted=filter->position+(filter->velocity*(s32)dt)/MS_PER_S;
+		residual=measured-predicted;
+		//2-gate: reject changes faster than the car and obstacle can move
+		step=((s32)US_MAX_SPEED_CMS*(s32)dt/MS_PER_S+US_GATE_MARGIN_CM)*Q8_ONE;
+		if((residual > step || residual < -step) && filter->rejects < US_MAX_REJECTS)
+		{
+			filter->rejects++;
+			filter->position=predicted;				//coast on prediction
+		}
+		else if(residual > step || residual < -step)
+		{
+			filter->position=measured;				//readings stay away, the scene changed: re-lock
+			filter->velocity=0;
+			filter->rejects=0;
+		}
+		else
+		{
+			//3-alpha beta
+			filter->position=predicted+(US_ALPHA_Q8*residual)/Q8_ONE;
+			filter->velocity+=((US_BETA_Q8*residual)/Q8_ONE)*MS_PER_S/(s32)dt;
+			if(filter->velocity > (s32)US_MAX_SPEED_CMS*Q8_ONE)
+				filter->velocity=(s32)US_MAX_SPEED_CMS*Q8_ONE;
+			else if(filter->velocity < -(s32)US_MAX_SPEED_CMS*Q8_ONE)
+				filter->velocity=-(s32)US_MAX_SPEED_CMS*Q8_ONE;
+			filter->rejects=0;
+		}
+	}
+	filter->lastTime=u32_a_time;
+	if(filter->position < 0)
+		filter->position=0;
+	sample->filteredDistance=(u16)((filter->position+Q8_ONE/2)/Q8_ONE);
+	sample->closingVelocity=(s16)(-filter->velocity/Q8_ONE);
+}
+
+//publish measurement, readers retry if sequence changed or is odd while they copy
+static void US_publish(u8 u8_a_sensor,const ST_US_Sample *sample)
+{
+	u8_g_sampleSequence[u8_a_sensor]++;
+	ST_g_samples[u8_a_sensor].distance=sample->distance;
+	ST_g_samples[u8_a_sensor].filteredDistance=sample->filteredDistance;
+	ST_g_samples[u8_a_sensor].closingVelocity=sample->closingVelocity;
+	ST_g_samples[u8_a_sensor].status=sample->status;
+	ST_g_samples[u8_a_sensor].timestamp=sample->timestamp;
+	u8_g_sampleSequence[u8_a_sensor]++;
+}
+
+//start measurement, en_g_status must be checked by caller
+static void US_start(u8 u8_a_sensor)
+{
+	u8_g_active=u8_a_sensor;
+	u8_g_edgeCount=0;
+	en_g_status=US_BUSY;							//set before trigger, so echo edges are accepted
+	SWT_startTimer(u8_g_timerId, US_ECHO_TIMEOUT_MS, SWT_U8_MODE_ONE_SHOT, US_echoTimeout);
+	US_Trigger();
+}
+
+//called from ISR context only (edge or tick ISR), so it is never interrupted by the other one
+static void US_complete(u16 u16_a_distance,EN_US_status en_a_status)
+{
+	u32 u32_l_now=SWT_getMillis();
+	ST_US_Sample ST_l_sample={u16_a_distance,0,0,en_a_status,u32_l_now};
+	ICU_setEdgeDetectionType(ST_g_sensors[u8_g_active].echoSource,RISING);
+	u8_g_edgeCount=0;
+	//filter valid readings, any other status breaks the history
+	if(en_a_status == US_OK)
+	{
+		US_filter(&ST_g_filters[u8_g_active],u16_a_distance,u32_l_now,&ST_l_sample);
+	}
+	else
+	{
+		ST_g_filters[u8_g_active].index=0;			//median window restarts at slot 0, so it only holds readings since the reset
+		ST_g_filters[u8_g_active].count=0;
+		ST_g_filters[u8_g_active].locked=0;
+	}
+	US_publish(u8_g_active,&ST_l_sample);
+	//count samples, rate is updated once per window
+	if((u32_l_now-u32_g_rateWindowStart) >= RATE_WINDOW_MS)
+	{
+		u16_g_sampleRate=u16_g_sampleCount;
+		u16_g_sampleCount=0;
+		u32_g_rateWindowStart=u32_l_now;
+	}
+	u16_g_sampleCount++;
+	en_g_status=en_a_status;
+	//next sensor is triggered after the guard time, earliest moment free of crosstalk
+	if(u8_g_autoRunning)
+		SWT_startTimer(u8_g_autoTimerId, u16_g_guardMS, SWT_U8_MODE_ONE_SHOT, US_autoTrigger);
+	if(g_callBackPtr != NULL)
+		g_callBackPtr();
+}
 
-void US_edgeProcessing(void)
+static void US_edgeProcessing(EN_ICU_Source source)
 {
+	u16 u16_l_timeHigh;
+	if(en_g_status != US_BUSY || source != ST_g_sensors[u8_g_active].echoSource)
+		return;										//edge is not part of the current measurement
 	u8_g_edgeCount++;
 	if(u8_g_edgeCount==1)
 	{
-		ICU_clearTimerValue();
-		ICU_setEdgeDetectionType(FALLING);
+		ICU_setEdgeDetectionType(source,FALLING);
 	}
 	else if(u8_g_edgeCount==2)
 	{
-		u16_g_timeHigh=ICU_getInputCaptureValue();
-		ICU_clearTimerValue();
-		ICU_setEdgeDetectionType(RISING);
+		//timebase is shared and never cleared, echo timeout is shorter than timer1 period
+		u16_l_timeHigh=ICU_getHighTime(source);
+		SWT_stopTimer(u8_g_timerId);
+		if((u16_l_timeHigh/US_US_PER_CM) > US_MAX_DISTANCE_CM)
+		{
+			US_complete(0,US_NO_ECHO);
+		}
+		else
+		{
+			US_complete(u16_l_timeHigh/US_US_PER_CM,US_OK);
+		}
 	}
 }
 
+static void US_echoInt0(void)
+{
+	US_edgeProcessing(EN_INT0);
+}
+
+static void US_echoInt1(void)
+{
+	US_edgeProcessing(EN_INT1);
+}
+
+static void US_echoInt2(void)
+{
+	US_edgeProcessing(EN_INT2);
+}
+
+static void US_echoIcp1(void)
+{
+	US_edgeProcessing(EN_ICP1);
+}
+
+static void (*const g_echoHandlers[MAX_INT])(void)={US_echoInt0,US_echoInt1,US_echoInt2,US_echoIcp1};
+
+static void US_echoTimeout(void)
+{
+	if(en_g_status == US_BUSY)
+	{
+		//no rising edge means the sensor did not answer, rising edge only means the sound did not return
+		US_complete(0,(u8_g_edgeCount==0) ? US_FAULT : US_NO_ECHO);
+	}
+}
+
+//called from tick ISR when guard time of previous measurement elapsed
+static void US_autoTrigger(void)
+{
+	if(u8_g_autoRunning && en_g_status != US_BUSY)
+		US_start((u8_g_active+1) % u8_g_sensorsCount);
+}
+
+/*============= FUNCTION DEFINITION =============*/
+
 /*
  * Description : Function to initialize the ultrasonic driver
- * 1-initialize ICU driver
+ * 1-initialize ICU channel of each distinct echo source
  * 2-set callback function
- * 3-setup trigger pin direction as output
- * 4-setup External interrupt source
+ * 3-setup trigger pins direction as output
+ * 4-reserve echo timeout and auto ranging software timers (SWT must be initialized)
  Inputs:
-  u8 a_triggerPort:trigger port 
-  a_triggerPin:trigger pin
-  en_a_echoPin: interrupt source pin [EN_INT0,EN_INT1,EN_INT2]
+  a_sensors: table of a_count sensors, sensor id is its index in the table
  */
-EN_state US_init(u8 a_triggerPort,u8 a_triggerPin,EN_ICU_Source en_a_echoPin)
+EN_state US_init(const ST_US_ConfigType *a_sensors,u8 a_count)
+{
+	u8 index,previous,shared;
+	if(a_sensors == NULL || a_count == 0 || a_count > US_MAX_SENSORS)
+		return invalid;
+	for(index=0;index<a_count;index++)
+	{
+		if(a_sensors[index].triggerPin > P7 || a_sensors[index].triggerPort > D || a_sensors[index].echoSource >= MAX_INT)
+			return invalid;
+	}
+	if(SWT_createTimer(&u8_g_timerId) != STD_TYPES_OK || SWT_createTimer(&u8_g_autoTimerId) != STD_TYPES_OK)
+		return invalid;
+	for(index=0;index<a_count;index++)
+	{
+		ST_US_ConfigType ST_L_sensor=a_sensors[index];
+		ST_ICU_ConfigType ST_L_IcuConfig={F_CPU_8,RISING,ST_L_sensor.echoSource};
+		//initialize echo channel once, even if shared by several sensors
+		shared=0;
+		for(previous=0;previous<index;previous++)
+		{
+			if(a_sensors[previous].echoSource == ST_L_sensor.echoSource)
+				shared=1;
+		}
+		if(!shared)
+		{
+			if(ICU_init(&ST_L_IcuConfig) != valid)
+				return invalid;
+			ICU_setCallBack(ST_L_sensor.echoSource,g_echoHandlers[ST_L_sensor.echoSource]);
+		}
+		ST_g_sensors[index]=ST_L_sensor;
+		ST_g_samples[index].status=US_IDLE;
+		DIO_init(ST_L_sensor.triggerPort, ST_L_sensor.triggerPin, OUT);		 //setup trigger pin direction as output
+		DIO_write(ST_L_sensor.triggerPort, ST_L_sensor.triggerPin, LOW);
+	}
+	u8_g_sensorsCount=a_count;
+	return valid;
+}
+
+EN_state US_setCallBack(void(*a_ptr)(void))
 {
-	if(a_triggerPin <= P7 && a_triggerPin >= P0 && a_triggerPort >= A && a_triggerPort <= D && en_a_echoPin < MAX_INT)
+	if(a_ptr != NULL)
 	{
-		ST_ICU_ConfigType ST_L_IcuConfig={F_CPU_8,RISING,en_a_echoPin};
-		u8_g_triggerPort=a_triggerPort;
-		u8_g_triggerPin=a_triggerPin;
-		ICU_init(&ST_L_IcuConfig);
-		ICU_setCallBack(US_edgeProcessing);
-		DIO_init(a_triggerPort, a_triggerPin, OUT);		 //setup trigger pin direction as output
-		DIO_write(a_triggerPort, a_triggerPin, LOW);
+		g_callBackPtr=a_ptr;
 		return valid;
 	}
 	return invalid;
 }
 
+//called with interrupts disabled (from ISR, or from main with GIE cleared)
+static void US_Trigger(void)
+{
+	u8 u8_l_port=ST_g_sensors[u8_g_active].triggerPort;
+	u8 u8_l_pin=ST_g_sensors[u8_g_active].triggerPin;
+	if(u8_l_port == D && u8_l_pin == P5)
+	{
+		TMR1_generatePulse(CHANNEL_A,US_TRIGGER_US);	//exact width, no CPU time
+	}
+	else if(u8_l_port == D && u8_l_pin == P4 && !TMR1_isSystemTickRunning())
+	{
+		TMR1_generatePulse(CHANNEL_B,US_TRIGGER_US);	//OCR1B is the system tick compare when the tick runs on timer1
+	}
+	else
+	{
+		DIO_write(u8_l_port, u8_l_pin,HIGH);
+		SWT_delayUS(US_TRIGGER_US);
+		DIO_write(u8_l_port, u8_l_pin,LOW);
+	}
+}
 
-void US_Trigger(void)
+EN_US_status US_startMeasurement(u8 a_sensor)
 {
-	DIO_write(u8_g_triggerPort, u8_g_triggerPin,HIGH);
-	//_delay_us(10);
-	TMR0_delayMS(1);
-	DIO_write(u8_g_triggerPort, u8_g_triggerPin,LOW);
+	EN_US_status en_l_status=US_BUSY;
+	u8 u8_l_sreg;
+	if(a_sensor >= u8_g_sensorsCount)
+		return US_FAULT;
+	u8_l_sreg=GLI_saveAndDisableGIE();				//auto trigger may start a measurement from tick ISR, GIE is restored as it was
+	if(en_g_status != US_BUSY)
+	{
+		US_start(a_sensor);
+		en_l_status=US_IDLE;
+	}
+	GLI_restoreGIE(u8_l_sreg);
+	return en_l_status;
 }
 
-u16 US_readDistance(void)
+EN_US_status US_getDistance(u8 a_sensor,u16 *a_distance)
+{
+	ST_US_Sample ST_l_sample;
+	if(en_g_status == US_BUSY)
+		return US_BUSY;
+	if(US_readSample(a_sensor,&ST_l_sample) != valid)
+		return US_FAULT;
+	if(ST_l_sample.status == US_OK && a_distance != NULL)
+		*a_distance=ST_l_sample.distance;
+	return ST_l_sample.status;
+}
+
+EN_state US_startAutoRanging(u16 a_guardMS)
+{
+	u8 u8_l_sreg;
+	if(a_guardMS != 0 && u8_g_sensorsCount != 0)
+	{
+		u8_l_sreg=GLI_saveAndDisableGIE();			//tick ISR may chain a measurement, GIE is restored as it was (ISR or init safe)
+		u16_g_guardMS=a_guardMS;
+		u8_g_autoRunning=1;
+		//start now if idle, else the running measurement chains the next one on completion
+		if(en_g_status != US_BUSY)
+			US_start((u8_g_active+1) % u8_g_sensorsCount);
+		GLI_restoreGIE(u8_l_sreg);
+		return valid;
+	}
+	return invalid;
+}
+
+void US_stopAutoRanging(void)
+{
+	u8_g_autoRunning=0;
+	SWT_stopTimer(u8_g_autoTimerId);
+}
+
+EN_state US_readSample(u8 a_sensor,ST_US_Sample *a_sample)
+{
+	u8 u8_l_sequence;
+	if(a_sample != NULL && a_sensor < u8_g_sensorsCount)
+	{
+		do{
+			u8_l_sequence=u8_g_sampleSequence[a_sensor];
+			a_sample->distance=ST_g_samples[a_sensor].distance;
+			a_sample->filteredDistance=ST_g_samples[a_sensor].filteredDistance;
+			a_sample->closingVelocity=ST_g_samples[a_sensor].closingVelocity;
+			a_sample->status=ST_g_samples[a_sensor].status;
+			a_sample->timestamp=ST_g_samples[a_sensor].timestamp;
+		}while((u8_l_sequence & 1) || (u8_l_sequence != u8_g_sampleSequence[a_sensor]));	//sample was published while copying
+		return valid;
+	}
+	return invalid;
+}
+
+u16 US_getSampleRate(void)
+{
+	u16 u16_l_rate;
+	//read again if ISR updated the rate in the middle of the read
+	do{
+		u16_l_rate=u16_g_sampleRate;
+	}while(u16_l_rate != u16_g_sampleRate);
+	return u16_l_rate;
+}
+
+u16 US_readDistance(u8 a_sensor)
 {
 	u16 u16_L_value=0;
-	US_Trigger();
-	while(u8_g_edgeCount != 2);   //wait until ultrasonic sound to travel towards the object and return.
-	u16_L_value=((u16)u16_g_timeHigh/58);
-	u8_g_edgeCount=0;            //clear edge count to be ready for new read
+	US_startMeasurement(a_sensor);
+	while(US_getDistance(a_sensor,&u16_L_value) == US_BUSY);   //wait until sound returns or echo timeout expires
 	return u16_L_value;
 }
@@ -0,0 +1,22 @@
+/*
+ * sch_config.h
+ *
+ *   Created on: Oct 17, 2026
+ *       Author: Bits 0101 Tribe - https://github.com/AbdelrhmanWalaa/Obstacle-Avoidance-Car.git
+ *  Description: This file contains all Scheduler (SCH) pre-build configurations, through which user can configure before using the SCH.
+ */
+
+#ifndef SCH_CONFIG_H_
+#define SCH_CONFIG_H_
+
+/*******************************************************************************************************************************************************************/
+/* SCH Configurations */
+
+/* Number of Task(s), the Tasks table is passed to SCH_initialization */
+#define SCH_U8_NUMBER_OF_TASKS		4
+
+/* End of Configurations */
+
+/*******************************************************************************************************************************************************************/
+
+#endif /* SCH_CONFIG_H_ */
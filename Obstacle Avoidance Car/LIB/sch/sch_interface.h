@@ -0,0 +1,51 @@
+/*
+ * sch_interface.h
+ *
+ *   Created on: Oct 17, 2026
+ *       Author: Bits 0101 Tribe - https://github.com/AbdelrhmanWalaa/Obstacle-Avoidance-Car.git
+ *  Description: This file contains all Scheduler (SCH) functions' prototypes and definitions (Macros) to avoid magic numbers.
+ *				 SCH is a time-triggered cooperative scheduler, released by the 1 ms system tick and dispatched from the superloop.
+ */
+
+#ifndef SCH_INTERFACE_H_
+#define SCH_INTERFACE_H_
+
+/*******************************************************************************************************************************************************************/
+/* SCH Includes */
+
+/* LIB */
+#include "../std_types/std_types.h"
+#include "../bit_math/bit_math.h"
+
+#include "../swt/swt_interface.h"
+
+/*******************************************************************************************************************************************************************/
+/* SCH Macros */
+
+/* SCH Task Configurations, Period and Offset are in ticks ( ms ) */
+typedef struct
+{
+	void ( *pf_g_task ) ( void );
+	u16 u16_g_period;
+	u16 u16_g_offset;
+} SCH_ST_TASK_CONFIG;
+
+/* SCH Task Statistics */
+typedef struct
+{
+	u32 u32_g_worstCaseTimeUS;		/* Longest measured execution time in us */
+	u32 u32_g_runs;					/* Number of completed runs */
+	u16 u16_g_overruns;				/* Number of releases missed, as the previous release was not dispatched yet */
+} SCH_ST_TASK_STATS;
+
+/*******************************************************************************************************************************************************************/
+/* SCH Functions' Prototypes */
+
+u8   SCH_initialization( const SCH_ST_TASK_CONFIG *pst_a_tasks );
+u8   SCH_start		   ( void );
+void SCH_dispatchTasks ( void );
+u8   SCH_getTaskStats  ( u8 u8_a_taskIndex, SCH_ST_TASK_STATS *pst_a_returnedStats );
+
+/*******************************************************************************************************************************************************************/
+
+#endif /* SCH_INTERFACE_H_ */
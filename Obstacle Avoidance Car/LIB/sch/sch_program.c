@@ -0,0 +1,230 @@
+/*
+ * sch_program.c
+ *
+ *   Created on: Oct 17, 2026
+ *       Author: Bits 0101 Tribe - https://github.com/AbdelrhmanWalaa/Obstacle-Avoidance-Car.git
+ *  Description: This file contains all Scheduler (SCH) functions' implementation.
+ */
+
+/* LIB */
+#include "sch_config.h"
+#include "sch_interface.h"
+
+/*******************************************************************************************************************************************************************/
+/* Declaration and Initialization */
+
+/* Global Pointer to the Tasks table */
+static const SCH_ST_TASK_CONFIG *pst_gs_tasks = NULL;
+
+/* Global Arrays to store remaining ticks until next release, and release flags ( set in tick ISR, cleared on dispatch ) */
+static volatile u16 u16_gs_ticksToRelease[SCH_U8_NUMBER_OF_TASKS];
+static volatile u8  u8_gs_released[SCH_U8_NUMBER_OF_TASKS];
+
+/* Global Array to store Tasks' Statistics */
+static volatile SCH_ST_TASK_STATS st_gs_stats[SCH_U8_NUMBER_OF_TASKS];
+
+/* Global variable to store SCH is started, SCH_update is registered on the system tick once only */
+static u8 u8_gs_started = 0;
+
+/*******************************************************************************************************************************************************************/
+/* SCH Private Functions' Prototypes */
+
+static void SCH_update( void );
+
+/*******************************************************************************************************************************************************************/
+/*
+ Name: SCH_initialization
+ Input: Pointer to st TasksConfig
+ Output: u8 Error or No Error
+ Description: Function to Initialize SCH with a fixed Tasks table ( SCH_U8_NUMBER_OF_TASKS entries ), Task index is its priority ( 0 is highest ).
+*/
+u8 SCH_initialization( const SCH_ST_TASK_CONFIG *pst_a_tasks )
+{
+	/* Define local variable to set the error state = OK */
+	u8 u8_l_errorState = STD_TYPES_OK;
+	
+	/* Check 1: Pointer is not equal to NULL */
+	if ( pst_a_tasks != NULL )
+	{
+		/* Loop: Until all Tasks are initialized */
+		for ( u8 u8_l_index = 0; u8_l_index < SCH_U8_NUMBER_OF_TASKS; u8_l_index++ )
+		{
+			/* Check 1.1: Task is missing, or its Period is zero */
+			if ( ( pst_a_tasks[u8_l_index].pf_g_task == NULL ) || ( pst_a_tasks[u8_l_index].u16_g_period == 0 ) )
+			{
+				/* Update error state = NOK, wrong Task! */
+				u8_l_errorState = STD_TYPES_NOK;
+			}
+			
+			/* Step 1: First release is after the Task Offset */
+			u16_gs_ticksToRelease[u8_l_index] = pst_a_tasks[u8_l_index].u16_g_offset;
+			u8_gs_released[u8_l_index] = 0;
+			
+			/* Step 2: Clear Task Statistics */
+			st_gs_stats[u8_l_index].u32_g_worstCaseTimeUS = 0;
+			st_gs_stats[u8_l_index].u32_g_runs = 0;
+			st_gs_stats[u8_l_index].u16_g_overruns = 0;
+		}
+		
+		/* Check 1.2: All Tasks are valid, then the Tasks table is accepted */
+		if ( u8_l_errorState == STD_TYPES_OK )
+		{
+			pst_gs_tasks = pst_a_tasks;
+		}
+	}
+	/* Check 2: Pointer is equal to NULL */
+	else
+	{
+		/* Update error state = NOK, Pointer is NULL! */
+		u8_l_errorState = STD_TYPES_NOK;
+	}
+	
+	return u8_l_errorState;
+}
+
+/*******************************************************************************************************************************************************************/
+/*
+ Name: SCH_start
+ Input: void
+ Output: u8 Error or No Error
+ Description: Function to start releasing Tasks on the 1 ms system tick ( SWT must be initialized ).
+*/
+u8 SCH_start		   ( void )
+{
+	/* Define local variable to set the error state = OK */
+	u8 u8_l_errorState = STD_TYPES_OK;
+	
+	/* Check 1: SCH is not started */
+	if ( !u8_gs_started )
+	{
+		/* Step 1: Register Tasks release on the system tick, started by SWT_initialization */
+		u8_l_errorState = SWT_addTickCallBack( SCH_update );
+		
+		/* Check 1.1: SCH_update is registered */
+		if ( u8_l_errorState == STD_TYPES_OK )
+		{
+			u8_gs_started = 1;
+		}
+	}
+	/* Check 2: SCH is already started */
+	else
+	{
+		/* Update error state = NOK, a second SCH_update registration would release Tasks twice! */
+		u8_l_errorState = STD_TYPES_NOK;
+	}
+	
+	return u8_l_errorState;
+}
+
+/*******************************************************************************************************************************************************************/
+/*
+ Name: SCH_dispatchTasks
+ Input: void
+ Output: void
+ Description: Function to run released Tasks in priority order, and measure their execution time ( to be called in the superloop ).
+*/
+void SCH_dispatchTasks ( void )
+{
+	u32 u32_l_startTime, u32_l_executionTime;
+	
+	/* Check 1: SCH is initialized */
+	if ( pst_gs_tasks != NULL )
+	{
+		/* Loop: On all Tasks, in priority order */
+		for ( u8 u8_l_index = 0; u8_l_index < SCH_U8_NUMBER_OF_TASKS; u8_l_index++ )
+		{
+			/* Check 1.1: Task is released */
+			if ( u8_gs_released[u8_l_index] )
+			{
+				/* Step 1: Clear release flag before running, a release during the run is counted as an overrun */
+				u8_gs_released[u8_l_index] = 0;
+				
+				/* Step 2: Run the Task, and measure its execution time */
+				u32_l_startTime = SWT_getMicros();
+				
+				pst_gs_tasks[u8_l_index].pf_g_task();
+				
+				u32_l_executionTime = SWT_getMicros() - u32_l_startTime;
+				
+				/* Step 3: Update Task Statistics */
+				if ( u32_l_executionTime > st_gs_stats[u8_l_index].u32_g_worstCaseTimeUS )
+				{
+					st_gs_stats[u8_l_index].u32_g_worstCaseTimeUS = u32_l_executionTime;
+				}
+				
+				st_gs_stats[u8_l_index].u32_g_runs++;
+			}
+		}
+	}
+}
+
+/*******************************************************************************************************************************************************************/
+/*
+ Name: SCH_getTaskStats
+ Input: u8 TaskIndex and Pointer to st ReturnedStats
+ Output: u8 Error or No Error
+ Description: Function to get the worst-case execution time, runs and overruns of a Task.
+*/
+u8 SCH_getTaskStats  ( u8 u8_a_taskIndex, SCH_ST_TASK_STATS *pst_a_returnedStats )
+{
+	/* Define local variable to set the error state = OK */
+	u8 u8_l_errorState = STD_TYPES_OK;
+	
+	/* Check 1: TaskIndex is in the valid range, and Pointer is not equal to NULL */
+	if ( ( u8_a_taskIndex < SCH_U8_NUMBER_OF_TASKS ) && ( pst_a_returnedStats != NULL ) )
+	{
+		/* Step 1: Copy Statistics with Overruns read last, as it is the only field updated by the tick ISR ( u16 read is repeated until stable ) */
+		pst_a_returnedStats->u32_g_worstCaseTimeUS = st_gs_stats[u8_a_taskIndex].u32_g_worstCaseTimeUS;
+		pst_a_returnedStats->u32_g_runs = st_gs_stats[u8_a_taskIndex].u32_g_runs;
+		
+		do
+		{
+			pst_a_returnedStats->u16_g_overruns = st_gs_stats[u8_a_taskIndex].u16_g_overruns;
+		} while ( pst_a_returnedStats->u16_g_overruns != st_gs_stats[u8_a_taskIndex].u16_g_overruns );
+	}
+	/* Check 2: TaskIndex is not in the valid range, or Pointer is equal to NULL */
+	else
+	{
+		/* Update error state = NOK, wrong TaskIndex or Pointer is NULL! */
+		u8_l_errorState = STD_TYPES_NOK;
+	}
+	
+	return u8_l_errorState;
+}
+
+/*******************************************************************************************************************************************************************/
+/*
+ Name: SCH_update
+ Input: void
+ Output: void
+ Description: Function to release Tasks whose period elapsed ( called back from the system tick ISR every 1 ms ).
+*/
+static void SCH_update( void )
+{
+	/* Check 1: SCH is initialized */
+	if ( pst_gs_tasks != NULL )
+	{
+		/* Loop: On all Tasks */
+		for ( u8 u8_l_index = 0; u8_l_index < SCH_U8_NUMBER_OF_TASKS; u8_l_index++ )
+		{
+			/* Check 1.1: Task release time is reached */
+			if ( u16_gs_ticksToRelease[u8_l_index] == 0 )
+			{
+				/* Check 1.1.1: Previous release is not dispatched yet */
+				if ( u8_gs_released[u8_l_index] )
+				{
+					st_gs_stats[u8_l_index].u16_g_overruns++;
+				}
+				
+				/* Step 1: Release Task, and reload its Period */
+				u8_gs_released[u8_l_index] = 1;
+				u16_gs_ticksToRelease[u8_l_index] = pst_gs_tasks[u8_l_index].u16_g_period;
+			}
+			
+			/* Step 2: Count down to the next release */
+			u16_gs_ticksToRelease[u8_l_index]--;
+		}
+	}
+}
+
+/*******************************************************************************************************************************************************************/
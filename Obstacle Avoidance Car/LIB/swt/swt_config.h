@@ -0,0 +1,32 @@
+/*
+ * swt_config.h
+ *
+ *   Created on: Oct 17, 2026
+ *       Author: Bits 0101 Tribe - https://github.com/AbdelrhmanWalaa/Obstacle-Avoidance-Car.git
+ *  Description: This file contains all Software Timers (SWT) pre-build configurations, through which user can configure before using the SWT.
+ */
+
+#ifndef SWT_CONFIG_H_
+#define SWT_CONFIG_H_
+
+/*******************************************************************************************************************************************************************/
+/* SWT Configurations */
+
+/* Number of Software Timer(s) in the pool, each Timer is reserved once by SWT_createTimer */
+#define SWT_U8_NUMBER_OF_TIMERS		6
+
+/* System Tick Sources */
+#define SWT_U8_TICK_SOURCE_TMR0		0
+#define SWT_U8_TICK_SOURCE_TMR1		1
+
+/* System Tick Source */
+/* Options: SWT_U8_TICK_SOURCE_TMR0 : TMR0 CTC, 8 us uptime resolution, OC0 ( PB3 ) is not available for PWM
+			SWT_U8_TICK_SOURCE_TMR1 : OCR1B compare on the free running TMR1 shared with ICU, 1 us uptime resolution, TMR0 is free for PWM
+ */
+#define SWT_U8_TICK_SOURCE			SWT_U8_TICK_SOURCE_TMR1
+
+/* End of Configurations */
+
+/*******************************************************************************************************************************************************************/
+
+#endif /* SWT_CONFIG_H_ */
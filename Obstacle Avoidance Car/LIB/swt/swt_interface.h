@@ -0,0 +1,51 @@
+/*
+ * swt_interface.h
+ *
+ *   Created on: Oct 17, 2026
+ *       Author: Bits 0101 Tribe - https://github.com/AbdelrhmanWalaa/Obstacle-Avoidance-Car.git
+ *  Description: This file contains all Software Timers (SWT) functions' prototypes and definitions (Macros) to avoid magic numbers.
+ *				 SWT provides the monotonic system uptime ( ms / us ), non-float delays, and a pool of one-shot and periodic virtual Timers,
+ *				 all driven by the 1 ms system tick ( TMR0 or TMR1, see swt_config.h ).
+ */
+
+#ifndef SWT_INTERFACE_H_
+#define SWT_INTERFACE_H_
+
+/*******************************************************************************************************************************************************************/
+/* SWT Includes */
+
+/* LIB */
+#include "../std_types/std_types.h"
+#include "../bit_math/bit_math.h"
+
+/* MCAL */
+#include "../../MCAL/tmr0/tmr0_interface.h"
+#include "../../MCAL/tmr1/tmr1_interface.h"
+
+/*******************************************************************************************************************************************************************/
+/* SWT Macros */
+
+/* SWT Timer Modes */
+#define SWT_U8_MODE_ONE_SHOT		0
+#define SWT_U8_MODE_PERIODIC		1
+
+/*******************************************************************************************************************************************************************/
+/* SWT Functions' Prototypes */
+
+u8   SWT_initialization	 ( void );
+u8   SWT_addTickCallBack ( void ( *pf_a_tickCallBack ) ( void ) );
+
+u32  SWT_getMillis		 ( void );
+u32  SWT_getMicros		 ( void );
+
+void SWT_delayMS		 ( u16 u16_a_timeMS );
+void SWT_delayUS		 ( u16 u16_a_timeUS );
+
+u8   SWT_createTimer	 ( u8 *pu8_a_returnedTimerId );
+u8   SWT_startTimer		 ( u8 u8_a_timerId, u16 u16_a_timeMS, u8 u8_a_mode, void ( *pf_a_callBack ) ( void ) );
+u8   SWT_stopTimer		 ( u8 u8_a_timerId );
+u8   SWT_isExpired		 ( u8 u8_a_timerId, u8 *pu8_a_returnedFlag );
+
+/*******************************************************************************************************************************************************************/
+
+#endif /* SWT_INTERFACE_H_ */
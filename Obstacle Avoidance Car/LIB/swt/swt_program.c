@@ -0,0 +1,358 @@
+/*
+ * swt_program.c
+ *
+ *   Created on: Oct 17, 2026
+ *       Author: Bits 0101 Tribe - https://github.com/AbdelrhmanWalaa/Obstacle-Avoidance-Car.git
+ *  Description: This file contains all Software Timers (SWT) functions' implementation.
+ */
+
+/* LIB */
+#include "swt_config.h"
+#include "swt_interface.h"
+
+/*******************************************************************************************************************************************************************/
+/* Declaration and Initialization */
+
+/* System Tick Driver */
+#if ( SWT_U8_TICK_SOURCE == SWT_U8_TICK_SOURCE_TMR1 )
+#define SWT_startSystemTick			TMR1_startSystemTick
+#define SWT_addSystemTickCallBack	TMR1_addTickCallBack
+#define SWT_getSystemTicks			TMR1_getTicks
+#define SWT_getSystemMicros			TMR1_getMicros
+#define SWT_U8_US_PER_COUNT			SYSTEM_TICK_TMR1_US_PER_COUNT
+#else
+#define SWT_startSystemTick			TMR0_startSystemTick
+#define SWT_addSystemTickCallBack	TMR0_addTickCallBack
+#define SWT_getSystemTicks			TMR0_getTicks
+#define SWT_getSystemMicros			TMR0_getMicros
+#define SWT_U8_US_PER_COUNT			SYSTEM_TICK_US_PER_COUNT
+#endif
+
+/* SWT Timer States */
+#define SWT_U8_STATE_FREE			0
+#define SWT_U8_STATE_STOPPED		1
+#define SWT_U8_STATE_RUNNING		2
+
+/* SWT Timer */
+typedef struct
+{
+	void ( *pf_g_callBack ) ( void );
+	u16 u16_g_remainingMS;
+	u16 u16_g_periodMS;
+	u8  u8_g_mode;
+	u8  u8_g_state;				/* Written last by the caller, so the tick ISR never sees a half-configured Timer */
+	u8  u8_g_expiredFlag;
+} SWT_ST_TIMER;
+
+/* Global Array of the Timers pool ( shared with the tick ISR ) */
+static volatile SWT_ST_TIMER st_gs_timers[SWT_U8_NUMBER_OF_TIMERS];
+
+/* Global variable to store SWT is initialized, SWT_update is registered on the system tick once only */
+static u8 u8_gs_initialized = 0;
+
+/*******************************************************************************************************************************************************************/
+/* SWT Private Functions' Prototypes */
+
+static void SWT_update( void );
+
+/*******************************************************************************************************************************************************************/
+/*
+ Name: SWT_initialization
+ Input: void
+ Output: u8 Error or No Error
+ Description: Function to Initialize SWT, and start the 1 ms system tick ( Timers, uptime and delays need the global interrupt enabled ).
+*/
+u8 SWT_initialization	 ( void )
+{
+	/* Define local variable to set the error state = OK */
+	u8 u8_l_errorState = STD_TYPES_OK;
+	
+	/* Check 1: SWT is not initialized */
+	if ( !u8_gs_initialized )
+	{
+		/* Loop: Until all Timers are free */
+		for ( u8 u8_l_index = 0; u8_l_index < SWT_U8_NUMBER_OF_TIMERS; u8_l_index++ )
+		{
+			st_gs_timers[u8_l_index].u8_g_state = SWT_U8_STATE_FREE;
+			st_gs_timers[u8_l_index].u8_g_expiredFlag = 0;
+		}
+		
+		/* Step 1: Register Timers update on the system tick */
+		if ( SWT_addSystemTickCallBack( SWT_update ) == FALSE )
+		{
+			/* Update error state = NOK, no free tick call back slot! */
+			u8_l_errorState = STD_TYPES_NOK;
+		}
+		
+		/* Step 2: Start the system tick ( no effect if already started ) */
+		SWT_startSystemTick();
+		
+		u8_gs_initialized = 1;
+	}
+	/* Check 2: SWT is already initialized */
+	else
+	{
+		/* Update error state = NOK, a second SWT_update registration would count Timers twice! */
+		u8_l_errorState = STD_TYPES_NOK;
+	}
+	
+	return u8_l_errorState;
+}
+
+/*******************************************************************************************************************************************************************/
+/*
+ Name: SWT_addTickCallBack
+ Input: Pointer to Function that takes void and returns void
+ Output: u8 Error or No Error
+ Description: Function to add a function called back from the system tick ISR every 1 ms.
+*/
+u8 SWT_addTickCallBack ( void ( *pf_a_tickCallBack ) ( void ) )
+{
+	/* Define local variable to set the error state = OK */
+	u8 u8_l_errorState = STD_TYPES_OK;
+	
+	/* Check 1: Pointer is equal to NULL, or all tick call back slots are used */
+	if ( SWT_addSystemTickCallBack( pf_a_tickCallBack ) == FALSE )
+	{
+		/* Update error state = NOK, Pointer is NULL or no free slot! */
+		u8_l_errorState = STD_TYPES_NOK;
+	}
+	
+	return u8_l_errorState;
+}
+
+/*******************************************************************************************************************************************************************/
+/*
+ Name: SWT_getMillis
+ Input: void
+ Output: u32 Uptime in ms
+ Description: Function to get the monotonic uptime in ms ( wraps after 49.7 days, use unsigned subtraction to compare ).
+*/
+u32 SWT_getMillis		 ( void )
+{
+	return SWT_getSystemTicks();
+}
+
+/*******************************************************************************************************************************************************************/
+/*
+ Name: SWT_getMicros
+ Input: void
+ Output: u32 Uptime in us
+ Description: Function to get the monotonic uptime in us ( resolution is 1 us on TMR1 or 8 us on TMR0 at 8 MHz, wraps after 71.6 minutes, use unsigned subtraction to compare ).
+*/
+u32 SWT_getMicros		 ( void )
+{
+	return SWT_getSystemMicros();
+}
+
+/*******************************************************************************************************************************************************************/
+/*
+ Name: SWT_delayMS
+ Input: u16 TimeMS
+ Output: void
+ Description: Function to wait at least TimeMS, without touching any timer registers ( not to be called from an ISR, as the tick would never advance ).
+*/
+void SWT_delayMS		 ( u16 u16_a_timeMS )
+{
+	u32 u32_l_startTime = SWT_getSystemTicks();
+	
+	/* Step 1: Wait for one extra tick, as the current tick is already partially elapsed */
+	while ( ( SWT_getSystemTicks() - u32_l_startTime ) <= u16_a_timeMS );
+}
+
+/*******************************************************************************************************************************************************************/
+/*
+ Name: SWT_delayUS
+ Input: u16 TimeUS
+ Output: void
+ Description: Function to wait at least TimeUS ( rounded up to the us resolution ), safe to be called from an ISR.
+*/
+void SWT_delayUS		 ( u16 u16_a_timeUS )
+{
+	u32 u32_l_startTime = SWT_getSystemMicros();
+	
+	/* Step 1: Wait for one extra count, as the current count is already partially elapsed */
+	while ( ( SWT_getSystemMicros() - u32_l_startTime ) < ( (u32)u16_a_timeUS + SWT_U8_US_PER_COUNT ) );
+}
+
+/*******************************************************************************************************************************************************************/
+/*
+ Name: SWT_createTimer
+ Input: Pointer to u8 ReturnedTimerId
+ Output: u8 Error or No Error
+ Description: Function to reserve a free Timer from the pool ( to be called once, at initialization ).
+*/
+u8 SWT_createTimer	 ( u8 *pu8_a_returnedTimerId )
+{
+	/* Define local variable to set the error state = NOK, until a free Timer is found */
+	u8 u8_l_errorState = STD_TYPES_NOK;
+	
+	/* Check 1: Pointer is not equal to NULL */
+	if ( pu8_a_returnedTimerId != NULL )
+	{
+		/* Loop: Until a free Timer is found */
+		for ( u8 u8_l_index = 0; u8_l_index < SWT_U8_NUMBER_OF_TIMERS; u8_l_index++ )
+		{
+			/* Check 1.1: Timer is free */
+			if ( st_gs_timers[u8_l_index].u8_g_state == SWT_U8_STATE_FREE )
+			{
+				st_gs_timers[u8_l_index].u8_g_expiredFlag = 0;
+				st_gs_timers[u8_l_index].u8_g_state = SWT_U8_STATE_STOPPED;
+				
+				*pu8_a_returnedTimerId = u8_l_index;
+				
+				/* Update error state = OK, Timer is reserved */
+				u8_l_errorState = STD_TYPES_OK;
+				
+				break;
+			}
+		}
+	}
+	
+	return u8_l_errorState;
+}
+
+/*******************************************************************************************************************************************************************/
+/*
+ Name: SWT_startTimer
+ Input: u8 TimerId, u16 TimeMS, u8 Mode, and Pointer to Function that takes void and returns void
+ Output: u8 Error or No Error
+ Description: Function to (re)start a Timer in one-shot or periodic Mode, CallBack ( optional, may be NULL ) runs in the tick ISR on expiry,
+			  and the expired flag is set in both cases.
+*/
+u8 SWT_startTimer		 ( u8 u8_a_timerId, u16 u16_a_timeMS, u8 u8_a_mode, void ( *pf_a_callBack ) ( void ) )
+{
+	/* Define local variable to set the error state = OK */
+	u8 u8_l_errorState = STD_TYPES_OK;
+	
+	/* Check 1: TimerId is reserved, TimeMS is not zero, and Mode is in the valid range */
+	if ( ( u8_a_timerId < SWT_U8_NUMBER_OF_TIMERS ) && ( st_gs_timers[u8_a_timerId].u8_g_state != SWT_U8_STATE_FREE ) &&
+		 ( u16_a_timeMS != 0 ) && ( u8_a_mode <= SWT_U8_MODE_PERIODIC ) )
+	{
+		/* Step 1: Stop Timer, so that tick ISR ignores it while being configured */
+		st_gs_timers[u8_a_timerId].u8_g_state = SWT_U8_STATE_STOPPED;
+		
+		/* Step 2: Configure Timer */
+		st_gs_timers[u8_a_timerId].pf_g_callBack = pf_a_callBack;
+		st_gs_timers[u8_a_timerId].u16_g_remainingMS = u16_a_timeMS;
+		st_gs_timers[u8_a_timerId].u16_g_periodMS = u16_a_timeMS;
+		st_gs_timers[u8_a_timerId].u8_g_mode = u8_a_mode;
+		st_gs_timers[u8_a_timerId].u8_g_expiredFlag = 0;
+		
+		/* Step 3: Run Timer */
+		st_gs_timers[u8_a_timerId].u8_g_state = SWT_U8_STATE_RUNNING;
+	}
+	/* Check 2: TimerId is not reserved, TimeMS is zero, or Mode is not in the valid range */
+	else
+	{
+		/* Update error state = NOK, wrong TimerId, TimeMS or Mode! */
+		u8_l_errorState = STD_TYPES_NOK;
+	}
+	
+	return u8_l_errorState;
+}
+
+/*******************************************************************************************************************************************************************/
+/*
+ Name: SWT_stopTimer
+ Input: u8 TimerId
+ Output: u8 Error or No Error
+ Description: Function to stop a Timer, Timer stays reserved and can be restarted.
+*/
+u8 SWT_stopTimer		 ( u8 u8_a_timerId )
+{
+	/* Define local variable to set the error state = OK */
+	u8 u8_l_errorState = STD_TYPES_OK;
+	
+	/* Check 1: TimerId is reserved */
+	if ( ( u8_a_timerId < SWT_U8_NUMBER_OF_TIMERS ) && ( st_gs_timers[u8_a_timerId].u8_g_state != SWT_U8_STATE_FREE ) )
+	{
+		st_gs_timers[u8_a_timerId].u8_g_state = SWT_U8_STATE_STOPPED;
+	}
+	/* Check 2: TimerId is not reserved */
+	else
+	{
+		/* Update error state = NOK, wrong TimerId! */
+		u8_l_errorState = STD_TYPES_NOK;
+	}
+	
+	return u8_l_errorState;
+}
+
+/*******************************************************************************************************************************************************************/
+/*
+ Name: SWT_isExpired
+ Input: u8 TimerId and Pointer to u8 ReturnedFlag
+ Output: u8 Error or No Error
+ Description: Function to check if a Timer expired since the last check ( flag is cleared on read, several expiries between two checks are reported once ).
+*/
+u8 SWT_isExpired		 ( u8 u8_a_timerId, u8 *pu8_a_returnedFlag )
+{
+	/* Define local variable to set the error state = OK */
+	u8 u8_l_errorState = STD_TYPES_OK;
+	
+	/* Check 1: TimerId is reserved, and Pointer is not equal to NULL */
+	if ( ( u8_a_timerId < SWT_U8_NUMBER_OF_TIMERS ) && ( st_gs_timers[u8_a_timerId].u8_g_state != SWT_U8_STATE_FREE ) &&
+		 ( pu8_a_returnedFlag != NULL ) )
+	{
+		u8 u8_l_statusRegister = SREG;
+		
+		/* Step 1: Read and clear the flag with the tick ISR held off, so no expiry lands between them */
+		CLR_BIT( SREG, SREG_I );
+		*pu8_a_returnedFlag = st_gs_timers[u8_a_timerId].u8_g_expiredFlag;
+		st_gs_timers[u8_a_timerId].u8_g_expiredFlag = 0;
+		SREG = u8_l_statusRegister;			/* Restore the Global Interrupt state */
+	}
+	/* Check 2: TimerId is not reserved, or Pointer is equal to NULL */
+	else
+	{
+		/* Update error state = NOK, wrong TimerId or Pointer is NULL! */
+		u8_l_errorState = STD_TYPES_NOK;
+	}
+	
+	return u8_l_errorState;
+}
+
+/*******************************************************************************************************************************************************************/
+/*
+ Name: SWT_update
+ Input: void
+ Output: void
+ Description: Function to count down running Timers ( called back from the system tick ISR every 1 ms ).
+*/
+static void SWT_update( void )
+{
+	/* Loop: On all Timers */
+	for ( u8 u8_l_index = 0; u8_l_index < SWT_U8_NUMBER_OF_TIMERS; u8_l_index++ )
+	{
+		/* Check 1: Timer is running */
+		if ( st_gs_timers[u8_l_index].u8_g_state == SWT_U8_STATE_RUNNING )
+		{
+			st_gs_timers[u8_l_index].u16_g_remainingMS--;
+			
+			/* Check 1.1: Timer expired */
+			if ( st_gs_timers[u8_l_index].u16_g_remainingMS == 0 )
+			{
+				/* Step 1: Reload periodic Timer, or stop one-shot Timer */
+				if ( st_gs_timers[u8_l_index].u8_g_mode == SWT_U8_MODE_PERIODIC )
+				{
+					st_gs_timers[u8_l_index].u16_g_remainingMS = st_gs_timers[u8_l_index].u16_g_periodMS;
+				}
+				else
+				{
+					st_gs_timers[u8_l_index].u8_g_state = SWT_U8_STATE_STOPPED;
+				}
+				
+				/* Step 2: Set expired flag, and call back */
+				st_gs_timers[u8_l_index].u8_g_expiredFlag = 1;
+				
+				if ( st_gs_timers[u8_l_index].pf_g_callBack != NULL )
+				{
+					st_gs_timers[u8_l_index].pf_g_callBack();
+				}
+			}
+		}
+	}
+}
+
+/*******************************************************************************************************************************************************************/
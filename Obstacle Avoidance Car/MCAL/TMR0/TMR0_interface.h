@@ -16,46 +16,43 @@
 #include "../TMR_UTILITIES/TMR_Registers.h"
 
 /*============= extern variables =============*/
-extern volatile u8 g_timeout_flag;
 
 
 /*============= MACRO DEFINITION =============*/
-#define MAX_DELAY_COMP_MODE 40  //evaluate to 40*250ms=10 seconds
+#define SYSTEM_TICK_PRESCALER	P_64
+#define SYSTEM_TICK_OCR			((F_CPU/SYSTEM_TICK_PRESCALER/1000UL)-1)	//compare value of 1 ms tick
+#define SYSTEM_TICK_US_PER_COUNT	((SYSTEM_TICK_PRESCALER*1000000UL)/F_CPU)	//timer count resolution in us
+#define MAX_TICK_CALLBACKS		2		//number of functions called back on every system tick
+
+#if (SYSTEM_TICK_OCR > 255) || ((F_CPU % (SYSTEM_TICK_PRESCALER*1000UL)) != 0)
+#error "TMR0 system tick: F_CPU does not give an exact 1 ms tick with the selected prescaler"
+#endif
 
 /*============= FUNCTION PROTOTYPE =============*/
 
 /*
-Description
-use to apply block delay using overflow mode 
+Description:use to start 1 ms system tick using compare match mode
+timer0 is dedicated to the system tick, calling it again while the tick is running has no effect
 */
-void TMR0_delayMS(f32 delay);
+void TMR0_startSystemTick(void);
 
 /*
-Description
-use to stop timer functionality
+Description:use to add a function called back from the compare match ISR on every tick
+return TRUE if added, FALSE if all MAX_TICK_CALLBACKS are used or pointer is NULL
 */
-void TMR0_stop(void);
-
+u8 TMR0_addTickCallBack(void(*g_ptr)(void));
 
 /*
-Description
-use to call event after elapse timeout delay using overflow mode
-minimum delay is (1 ms)
+Description:use to get number of elapsed system ticks (ms) since TMR0_startSystemTick
+wraps after 49.7 days
 */
-void TMR0_callEvent(f32 delay,void(*g_ptr)(void));
+u32 TMR0_getTicks(void);
 
 /*
-Description:use to apply timeout function using compare match mode 
-to check that timeout use <g_timeout_flag> which by default is zero and change to 1 after timeout
-[maximum timeout] is 10.2 second
-to configure maximum timeout redefine MAX_DELAY_COMP_MODE 
-for example:
-assume OCR register (0--255) 
-max_timeout = MAX_DELAY_COMP_MODE * OCR
+Description:use to get elapsed time in microseconds since TMR0_startSystemTick
+resolution is SYSTEM_TICK_US_PER_COUNT (8 us at 8 MHz), wraps after 71.6 minutes
+safe to call with interrupts disabled (inside ISR)
 */
-void TMR0_timeoutMS(f32 delay); 
-
-//void TMR0_OVFSetCallBack (void(*g_ptr)(void));
-//void TMR0_CMPSetCallBack (void(*g_ptr)(void));
+u32 TMR0_getMicros(void);
 
-#endif /* TMR0_INTERFACE_H_ */
\ No newline at end of file
+#endif /* TMR0_INTERFACE_H_ */
@@ -39,6 +39,9 @@
 #define OCR2	(*((volatile u8*)0x43))
 #define ASSR	(*((volatile u8*)0x42))
 #define SFIOR	(*((volatile u8*)0x50))
+//status register, I bit is the global interrupt enable
+#define SREG	(*((volatile u8*)0x5F))
+#define SREG_I	7
 
 /*======timer0 pin names ====== */
 //TCCR0 timer counter control register
@@ -52,6 +52,7 @@ void DIO_setPortValue (EN_DIO_PortNumber en_a_portNumber, u8 u8_a_portValue);
 void DIO_getPortValue (EN_DIO_PortNumber en_a_portNumber, u8 *pu8_a_returnedPortValue);
 void DIO_setHigherNibble (EN_DIO_PortNumber en_a_portNumber, u8 u8_a_data);
 void DIO_setLowerNibble (EN_DIO_PortNumber en_a_portNumber, u8 u8_a_data);
+void DIO_writePortMasked (EN_DIO_PortNumber en_a_portNumber, u8 u8_a_mask, u8 u8_a_value);
 
 /*******************************************************************************************************************************************************************/
 
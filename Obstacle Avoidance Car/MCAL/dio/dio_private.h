@@ -29,6 +29,14 @@
 #define DIO_U8_DDRD_REG		    *( ( volatile u8 * ) 0x31 )
 #define DIO_U8_PIND_REG		    *( ( volatile u8 * ) 0x30 )
 
+#define DIO_U8_SREG_REG		    *( ( volatile u8 * ) 0x5F )
+
+/*******************************************************************************************************************************************************************/
+/* DIO Pins' Definitions */
+
+/* The AVR Status Register - SREG: Global Interrupt Enable */
+#define DIO_U8_I_BIT		    7
+
 /*******************************************************************************************************************************************************************/
 
 #endif /* DIO_PRIVATE_H_ */
\ No newline at end of file
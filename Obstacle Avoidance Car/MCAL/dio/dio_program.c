@@ -302,4 +302,38 @@ void DIO_setLowerNibble ( EN_DIO_PortNumber en_a_portNumber, u8 u8_a_data )
 	}
 }
 
-/*******************************************************************************************************************************************************************/
\ No newline at end of file
+/*******************************************************************************************************************************************************************/
+/*
+ Name: DIO_writePortMasked
+ Input: en PortNumber, u8 Mask, and u8 Value
+ Output: void
+ Description: Function to set the Mask pins of Port to Value in a single write, other pins are kept ( interrupts are held off during the read-modify-write ).
+*/
+void DIO_writePortMasked ( EN_DIO_PortNumber en_a_portNumber, u8 u8_a_mask, u8 u8_a_value )
+{
+	u8 u8_l_statusRegister = DIO_U8_SREG_REG;
+	
+	u8_a_value &= u8_a_mask;
+	
+	CLR_BIT( DIO_U8_SREG_REG, DIO_U8_I_BIT );	//Hold off ISRs writing the same Port
+	
+	switch(en_a_portNumber)
+	{
+		case A:
+			DIO_U8_PORTA_REG = ( DIO_U8_PORTA_REG & ~u8_a_mask ) | u8_a_value;
+		break;
+		case B:
+			DIO_U8_PORTB_REG = ( DIO_U8_PORTB_REG & ~u8_a_mask ) | u8_a_value;
+		break;
+		case C:
+			DIO_U8_PORTC_REG = ( DIO_U8_PORTC_REG & ~u8_a_mask ) | u8_a_value;
+		break;
+		case D:
+			DIO_U8_PORTD_REG = ( DIO_U8_PORTD_REG & ~u8_a_mask ) | u8_a_value;
+		break;
+	}
+	
+	DIO_U8_SREG_REG = u8_l_statusRegister;	//Restore the Global Interrupt state
+}
+
+/*******************************************************************************************************************************************************************/
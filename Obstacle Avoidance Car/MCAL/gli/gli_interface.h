@@ -22,6 +22,8 @@
 
 void GLI_enableGIE ( void );
 void GLI_disableGIE( void );
+u8   GLI_saveAndDisableGIE ( void );
+void GLI_restoreGIE ( u8 u8_a_statusRegister );
 
 /*******************************************************************************************************************************************************************/
 
@@ -35,4 +35,32 @@ void GLI_disableGIE( void )
 	CLR_BIT( GLI_U8_SREG_REG, GLI_U8_I_BIT );
 }
 
+/*******************************************************************************************************************************************************************/
+/*
+ Name: GLI_saveAndDisableGIE
+ Input: void
+ Output: u8 SREG before clearing I bit
+ Description: Function to save SREG then clear I bit, to start a critical section that is also safe inside an ISR or with GIE already disabled.
+*/
+u8 GLI_saveAndDisableGIE ( void )
+{
+	u8 u8_l_statusRegister = GLI_U8_SREG_REG;
+	
+	CLR_BIT( GLI_U8_SREG_REG, GLI_U8_I_BIT );
+	
+	return u8_l_statusRegister;
+}
+
+/*******************************************************************************************************************************************************************/
+/*
+ Name: GLI_restoreGIE
+ Input: u8 StatusRegister ( returned by GLI_saveAndDisableGIE )
+ Output: void
+ Description: Function to restore SREG, to end a critical section with the Global Interrupt Enable (GIE) as it was before.
+*/
+void GLI_restoreGIE ( u8 u8_a_statusRegister )
+{
+	GLI_U8_SREG_REG = u8_a_statusRegister;
+}
+
 /*******************************************************************************************************************************************************************/
\ No newline at end of file
@@ -13,6 +13,43 @@
 /*******************************************************************************************************************************************************************/
 /* PWM Configurations */
 
+/* PWM Backends */
+#define PWM_U8_BACKEND_SOFTWARE						0
+#define PWM_U8_BACKEND_HARDWARE						1
+
+/* PWM Backend */
+/* Options: PWM_U8_BACKEND_SOFTWARE : Any Port/Pin, pin is toggled in TMR2 OVF ISR twice per period
+			PWM_U8_BACKEND_HARDWARE : TMR2 Fast PWM on OC2 ( PD7 ) and TMR0 Fast PWM on OC0 ( PB3 ) only, duty change is one OCRn write, no ISR
+									  ( OC0 needs the system tick off TMR0, see swt_config.h )
+ */
+#define PWM_U8_BACKEND								PWM_U8_BACKEND_HARDWARE
+
+/* Hardware Backend Frequencies at 8 MHz ( F_CPU / ( Prescaler * 256 ) ), 256 timer steps per period at every frequency ( 101 duty levels of the 0 - 100% DutyCycle ):
+   31250 Hz ( Prescaler 1 ), 3906 Hz ( 8 ), 976 Hz ( 32, TMR2 only ), 488 Hz ( 64 ), 244 Hz ( 128, TMR2 only ), 122 Hz ( 256 ), 30 Hz ( 1024 )
+   Fast PWM TOP is fixed at 255 in TMR0/TMR2, so frequencies in between are rounded to the nearest one */
+
+/* Software Backend Frequency ( in Hz ), On/Off timings of all DutyCycles are computed for it at compile time */
+/* Note: PWM_initialization of the Software Backend only accepts this frequency, i.e. DCM_U8_FREQUENCY * 1000 */
+#define PWM_U16_SOFTWARE_FREQUENCY_HZ				488
+
+/* Software Backend Timing Benchmark, builds PWM_benchmarkTiming, which computes the On/Off timings of all DutyCycles with the float math of the
+   former PWM_generatePWM or reads them from the timing table, APP times both at start up ( SWT_getMicros ) and displays the time ( us ) of each */
+/* Options: 0 : Disabled
+			1 : Enabled ( PWM_U8_BACKEND_SOFTWARE only )
+ */
+#define PWM_U8_TIMING_BENCHMARK						0
+
+/* Software Backend ISR Load Measurement, the TMR2 OVF ISR accumulates its own run time read from TCNT1 ( free running with SWT_U8_TICK_SOURCE_TMR1 ),
+   APP displays at start up the ISR CPU cycles per PWM period and the CPU load ( % ) at PWM_U16_SOFTWARE_FREQUENCY_HZ, rebuild with another frequency
+   to compare ( the Hardware Backend has no ISR per period, only a one shot OVF when the duty moves to or from 0% ) */
+/* Options: 0 : Disabled
+			1 : Enabled ( PWM_U8_BACKEND_SOFTWARE only )
+ */
+#define PWM_U8_ISR_LOAD_MEASURE						0
+
+/* CPU cycles per TCNT1 count, i.e. SYSTEM_TICK_TMR1_PRESCALER of the system tick ( see tmr1_interface.h ) */
+#define PWM_U8_TCNT1_CYCLES_PER_COUNT				8
+
 /* Max Duty Cycle Value */
 #define PWM_U8_MAX_DUTY_CYCLE						100
 
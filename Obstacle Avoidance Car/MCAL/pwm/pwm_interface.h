@@ -37,11 +37,32 @@
 #define DIO_U8_PIN6			6
 #define DIO_U8_PIN7			7
 
+/* Hardware Backend Fast PWM frequency of Prescaler, and the max. frequency ( Prescaler 1 ), i.e. 31250 Hz at 8 MHz */
+#define PWM_U32_FAST_PWM_FREQUENCY_HZ( PRESCALER )	( F_CPU / ( ( PRESCALER ) * 256UL ) )
+#define PWM_U32_MAX_FREQUENCY_HZ					PWM_U32_FAST_PWM_FREQUENCY_HZ( 1UL )
+
+/* Hardware Backend frequency is exact on both TMR0 and TMR2 ( Prescaler 1, 8, 64, 256 or 1024 ) */
+#define PWM_IS_EXACT_FREQUENCY_HZ( FREQUENCY )		( ( ( FREQUENCY ) == PWM_U32_FAST_PWM_FREQUENCY_HZ(    1UL ) ) || ( ( FREQUENCY ) == PWM_U32_FAST_PWM_FREQUENCY_HZ(  8UL ) ) || \
+													  ( ( FREQUENCY ) == PWM_U32_FAST_PWM_FREQUENCY_HZ(   64UL ) ) || ( ( FREQUENCY ) == PWM_U32_FAST_PWM_FREQUENCY_HZ( 256UL ) ) || \
+													  ( ( FREQUENCY ) == PWM_U32_FAST_PWM_FREQUENCY_HZ( 1024UL ) ) )
+
+/* Timing Benchmark Methods */
+#define PWM_U8_TIMING_FLOAT							0
+#define PWM_U8_TIMING_TABLE							1
+
 /*******************************************************************************************************************************************************************/
 /* PWM Functions' prototypes */
 
 u8 PWM_initialization( u8 u8_a_portId, u8 u8_a_pinId, f32 f32_a_pwmFrequency );
 u8 PWM_generatePWM   ( u8 u8_a_dutyCycle );
+u8 PWM_generateChannelPWM( u8 u8_a_portId, u8 u8_a_pinId, u8 u8_a_dutyCycle );
+u8 PWM_setFrequency  ( u8 u8_a_portId, u8 u8_a_pinId, u32 u32_a_frequencyHz, u32 *pu32_a_returnedFrequencyHz, u16 *pu16_a_returnedDutySteps );
+
+/* PWM_U8_TIMING_BENCHMARK only */
+u8 PWM_benchmarkTiming( u8 u8_a_method );
+
+/* PWM_U8_ISR_LOAD_MEASURE only */
+u8 PWM_getISRLoad    ( u32 *pu32_a_returnedISRCycles, u16 *pu16_a_returnedPeriods );
 
 /*******************************************************************************************************************************************************************/
 
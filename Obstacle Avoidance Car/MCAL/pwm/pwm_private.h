@@ -29,6 +29,14 @@
 #define	TMR_U8_TIFR_REG			*( ( volatile u8 * ) 0x58 )
 #define	TMR_U8_SFIOR_REG		*( ( volatile u8 * ) 0x50 )
 
+/*
+ * 8-bit Timer/Counter0
+ */
+
+#define	TMR_U8_TCCR0_REG		*( ( volatile  u8 * ) 0x53 )
+#define	TMR_U8_TCNT0_REG		*( ( volatile  u8 * ) 0x52 )
+#define	TMR_U8_OCR0_REG			*( ( volatile  u8 * ) 0x5C )
+
 /*
  * 8-bit Timer/Counter2
  */
@@ -38,6 +46,12 @@
 #define	TMR_U8_OCR2_REG			*( ( volatile  u8 * ) 0x43 )
 #define	TMR_U8_ASSR_REG			*( ( volatile  u8 * ) 0x42 )
 
+/*
+ * 16-bit Timer/Counter1 ( read only, ISR Load Measurement )
+ */
+
+#define	TMR_U16_TCNT1_REG		*( ( volatile u16 * ) 0x4C )
+
 /*******************************************************************************************************************************************************************/
 /* TMR Registers' Description */
 
@@ -46,6 +60,8 @@
 #define TMR_U8_OCIE2_BIT		7
 /* Bit 6 - TOIE2: Timer/Counter2 Overflow Interrupt Enable */
 #define TMR_U8_TOIE2_BIT		6
+/* Bit 0 - TOIE0: Timer/Counter0 Overflow Interrupt Enable */
+#define TMR_U8_TOIE0_BIT		0
 /* End of TIMSK Register */
 
 /* Timer/Counter Interrupt Flag Register - TIFR */
@@ -53,6 +69,8 @@
 #define TMR_U8_OCF2_BIT			7
 /* Bit 6 - TOV2: Timer/Counter2 Overflow Flag */
 #define TMR_U8_TOV2_BIT			6
+/* Bit 0 - TOV0: Timer/Counter0 Overflow Flag */
+#define TMR_U8_TOV0_BIT			0
 /* End of TIFR Register */
 
 /* Special Function IO Register - SFIOR */
@@ -60,6 +78,19 @@
 #define TMR_U8_PSR2_BIT			1
 /* End of SFIOR Register */
 
+/*
+ * 8-bit Timer/Counter0 Registers' Description
+ */
+
+/* Timer/Counter Control Register - TCCR0 */
+/* Bit 6, 3 - WGM01:0: Waveform Generation Mode */
+#define TMR_U8_WGM01_BIT		3
+#define TMR_U8_WGM00_BIT		6
+/* Bit 5:4 - COM01:0: Compare Match Output Mode */
+#define TMR_U8_COM01_BIT		5
+#define TMR_U8_COM00_BIT		4
+/* End of TCCR0 Register */
+
 /*
  * 8-bit Timer/Counter2 Registers' Description
  */
@@ -96,12 +127,58 @@
 #define MIN_COUNT			1
 #define MAX_COUNT			256
 
+/* Hardware Backend Channels */
+#define PWM_U8_CHANNEL_OC0	0
+#define PWM_U8_CHANNEL_OC2	1
+#define PWM_U8_NUMBER_OF_CHANNELS	2
+#define PWM_U8_NO_CHANNEL	0xFF
+
+/* OC0 and OC2 Pins ( Hardware Backend ) */
+#define PWM_U8_OC0_PORT		DIO_U8_PORTB
+#define PWM_U8_OC0_PIN		DIO_U8_PIN3
+#define PWM_U8_OC2_PORT		DIO_U8_PORTD
+#define PWM_U8_OC2_PIN		DIO_U8_PIN7
+
+/* Max OCRn Value, Fast PWM TOP */
+#define PWM_U8_OCR_TOP		255
+
+/* Duty resolution of TIMER_STEPS per period, DutyCycle is a 0 - 100% input, so at most PWM_U8_MAX_DUTY_CYCLE + 1 levels are reachable */
+#define PWM_U16_EFFECTIVE_STEPS( TIMER_STEPS )	( ( ( TIMER_STEPS ) < ( PWM_U8_MAX_DUTY_CYCLE + 1 ) ) ? ( TIMER_STEPS ) : ( PWM_U8_MAX_DUTY_CYCLE + 1 ) )
+
+/* Software Backend Timing Table */
+/* TMR2 counts of the PWM period, in CPU cycles */
+#define PWM_U32_PERIOD_CYCLES			( F_CPU / PWM_U16_SOFTWARE_FREQUENCY_HZ )
+
+/* Off and On time of DutyCycle, in CPU cycles ( Off time is the DutyCycle part, the Pin toggles on both edges ) */
+#define PWM_U32_OFF_CYCLES( DUTY )		( ( PWM_U32_PERIOD_CYCLES * ( DUTY ) ) / PWM_U8_MAX_DUTY_CYCLE )
+#define PWM_U32_ON_CYCLES( DUTY )		( PWM_U32_PERIOD_CYCLES - PWM_U32_OFF_CYCLES( DUTY ) )
+
+/* Smallest TMR2 Prescaler, and its Clock Select value, that fits CYCLES in one overflow */
+#define PWM_U16_PRESCALER( CYCLES )		( ( ( CYCLES ) <= (    1UL * MAX_COUNT ) ) ?    1 : ( ( CYCLES ) <= (    8UL * MAX_COUNT ) ) ?    8 : \
+										  ( ( CYCLES ) <= (   32UL * MAX_COUNT ) ) ?   32 : ( ( CYCLES ) <= (   64UL * MAX_COUNT ) ) ?   64 : \
+										  ( ( CYCLES ) <= (  128UL * MAX_COUNT ) ) ?  128 : ( ( CYCLES ) <= (  256UL * MAX_COUNT ) ) ?  256 : 1024 )
+#define PWM_U8_CLOCK_SELECT( CYCLES )	( ( ( CYCLES ) <= (    1UL * MAX_COUNT ) ) ? 1 : ( ( CYCLES ) <= (    8UL * MAX_COUNT ) ) ? 2 : \
+										  ( ( CYCLES ) <= (   32UL * MAX_COUNT ) ) ? 3 : ( ( CYCLES ) <= (   64UL * MAX_COUNT ) ) ? 4 : \
+										  ( ( CYCLES ) <= (  128UL * MAX_COUNT ) ) ? 5 : ( ( CYCLES ) <= (  256UL * MAX_COUNT ) ) ? 6 : 7 )
+
+/* TMR2 Initial Value to overflow after CYCLES */
+#define PWM_U8_INITIAL_VALUE( CYCLES )	( ( u8 ) ( ( ( MAX_COUNT * ( u32 ) PWM_U16_PRESCALER( CYCLES ) ) - ( CYCLES ) ) / PWM_U16_PRESCALER( CYCLES ) ) )
+
+/* Timing Table Entry of DutyCycle */
+#define PWM_TIMING( DUTY )				{ PWM_U8_CLOCK_SELECT( PWM_U32_ON_CYCLES( DUTY ) ),  PWM_U8_INITIAL_VALUE( PWM_U32_ON_CYCLES( DUTY ) ), \
+										  PWM_U8_CLOCK_SELECT( PWM_U32_OFF_CYCLES( DUTY ) ), PWM_U8_INITIAL_VALUE( PWM_U32_OFF_CYCLES( DUTY ) ) }
+
+/* Float Timing Math of the former PWM_generatePWM, kept for the Timing Benchmark only */
 #define INITITAL_VALUE( T_MAX, T_DELAY, TICK )  ( ( ( f32 ) T_MAX - T_DELAY ) / TICK )
 
 #define MAX_DELAY_MS( PRESCALER ) ( ( ( ( f32 ) PRESCALER / F_CPU ) * MAX_COUNT ) * 1000UL )
 #define MIN_DELAY_MS( PRESCALER ) ( ( ( ( f32 ) PRESCALER / F_CPU ) * MIN_COUNT ) * 1000UL )
-#define MAX_DELAY_US( PRESCALER ) ( ( ( ( f32 ) PRESCALER / F_CPU ) * MAX_COUNT ) * 1000000UL )
-#define MIN_DELAY_US( PRESCALER ) ( ( ( ( f32 ) PRESCALER / F_CPU ) * MIN_COUNT ) * 1000000UL )
+
+/* TCCRn bits kept when Clock Select is written */
+#define PWM_U8_CLOCK_SELECT_MASK		0xF8
+
+/* Software Backend shortest period ( in CPU cycles ), two OVF ISRs ( ~100 cycles each with entry and exit ) at most 10% of CPU time */
+#define PWM_U16_SOFTWARE_MIN_PERIOD_CYCLES	2000
 
 /*******************************************************************************************************************************************************************/
 
@@ -11,32 +11,437 @@
 #include "pwm_private.h"
 #include "pwm_config.h"
 #include "pwm_interface.h"
+#include "../gli/gli_interface.h"
+
+/* AVR LIBC */
+#include <avr/pgmspace.h>
+
+#if ( PWM_U8_TIMING_BENCHMARK == 1 ) && ( PWM_U8_BACKEND == PWM_U8_BACKEND_HARDWARE )
+#error "PWM: PWM_U8_TIMING_BENCHMARK needs PWM_U8_BACKEND_SOFTWARE, the timing table is a Software Backend one"
+#endif
+
+#if ( PWM_U8_ISR_LOAD_MEASURE == 1 ) && ( PWM_U8_BACKEND == PWM_U8_BACKEND_HARDWARE )
+#error "PWM: PWM_U8_ISR_LOAD_MEASURE needs PWM_U8_BACKEND_SOFTWARE, the Hardware Backend has no ISR per period"
+#endif
+
+#if ( PWM_U8_BACKEND == PWM_U8_BACKEND_HARDWARE )
+
+/*******************************************************************************************************************************************************************/
+/* PWM Hardware Backend */
 
 /*******************************************************************************************************************************************************************/
 /* Declaration and Initialization */
 
+/* TMR0 and TMR2 Prescalers, from highest to lowest frequency ( Clock Select value is index + 1 ) */
+static const u16 Au16_gs_TMR0Prescalers[] = { TMR_U16_TMR_2_NO_PRESCALER, TMR_U16_TMR_2_8_PRESCALER, TMR_U16_TMR_2_64_PRESCALER, TMR_U16_TMR_2_256_PRESCALER, TMR_U16_TMR_2_1024_PRESCALER };
+static const u16 Au16_gs_TMR2Prescalers[] = { TMR_U16_TMR_2_NO_PRESCALER, TMR_U16_TMR_2_8_PRESCALER, TMR_U16_TMR_2_32_PRESCALER, TMR_U16_TMR_2_64_PRESCALER,
+											  TMR_U16_TMR_2_128_PRESCALER, TMR_U16_TMR_2_256_PRESCALER, TMR_U16_TMR_2_1024_PRESCALER };
+
+/* Global variable to store the initialized Channels, bit per Channel */
+static u8 u8_gs_channelsMask = 0;
+
+/* Global variable to store the staged OCn connection ( 0% duty is disconnected ), bit per Channel, committed by the OVF ISR at the period boundary */
+static volatile u8 u8_gs_connectMask = 0;
+
+/*******************************************************************************************************************************************************************/
+/* PWM Hardware Backend Private Functions' prototypes */
+
+static u8   PWM_getChannel     ( u8 u8_a_portId, u8 u8_a_pinId );
+static u8   PWM_selectClock    ( const u16 *pu16_a_prescalers, u8 u8_a_numberOfPrescalers, u32 u32_a_frequency, u32 *pu32_a_returnedFrequency );
+static void PWM_setChannelDuty ( u8 u8_a_channel, u8 u8_a_dutyCycle );
+
+/*******************************************************************************************************************************************************************/
+/*
+ Name: PWM_initialization
+ Input: u8 PortId, u8 PinId, and f32 PWMFrequency ( in KHz )
+ Output: u8 Error or No Error
+ Description: Function to Initialize one PWM Channel, TMR0 ( OC0 ) or TMR2 ( OC2 ) in Fast PWM mode with the prescaler giving the nearest frequency
+			  ( F_CPU / ( Prescaler * 256 ) ), it can be called once per Channel.
+*/
+u8 PWM_initialization( u8 u8_a_portId, u8 u8_a_pinId, f32 f32_a_pwmFrequency )
+{
+	/* Define local variable to set the error state = OK */
+	u8 u8_l_errorState = STD_TYPES_OK;
+	
+	u8 u8_l_channel = PWM_getChannel( u8_a_portId, u8_a_pinId );
+	
+	/* Check 1: Port and Pin are OC0 or OC2, and PWMFrequency is in the valid range */
+	if ( ( u8_l_channel != PWM_U8_NO_CHANNEL ) && ( f32_a_pwmFrequency > 0.0F ) )
+	{
+		/* Check 1.1: Required Channel */
+		switch ( u8_l_channel )
+		{
+			case PWM_U8_CHANNEL_OC0:
+				/* Step 1: Set the PWM Pin Direction to Out, and Value to Low */
+				SET_BIT( DIO_U8_DDRB_REG, u8_a_pinId );
+				CLR_BIT( DIO_U8_PORTB_REG, u8_a_pinId );
+				
+				/* Step 2: Set TMR0 in Fast PWM mode, OC0 is disconnected ( 0% duty ) until the first duty is set */
+				TMR_U8_OCR0_REG = 0;
+				TMR_U8_TCCR0_REG = ( 1 << TMR_U8_WGM00_BIT ) | ( 1 << TMR_U8_WGM01_BIT );
+			break;
+			
+			case PWM_U8_CHANNEL_OC2:
+				/* Step 1: Set the PWM Pin Direction to Out, and Value to Low */
+				SET_BIT( DIO_U8_DDRD_REG, u8_a_pinId );
+				CLR_BIT( DIO_U8_PORTD_REG, u8_a_pinId );
+				
+				/* Step 2: Set TMR2 in Fast PWM mode, OC2 is disconnected ( 0% duty ) until the first duty is set */
+				TMR_U8_OCR2_REG = 0;
+				TMR_U8_TCCR2_REG = ( 1 << TMR_U8_WGM20_BIT ) | ( 1 << TMR_U8_WGM21_BIT );
+			break;
+		}
+		
+		SET_BIT( u8_gs_channelsMask, u8_l_channel );
+		
+		/* Step 3: Start the Timer, Frequency is converted once, here only */
+		PWM_setFrequency( u8_a_portId, u8_a_pinId, ( u32 ) ( f32_a_pwmFrequency * 1000.0F ), NULL, NULL );
+	}
+	/* Check 2: Port and Pin are not OC0 or OC2, or PWMFrequency is not in the valid range */
+	else
+	{
+		/* Update error state = NOK, only OC0 and OC2 are supported by the Hardware Backend! */
+		u8_l_errorState = STD_TYPES_NOK;
+	}
+	
+	return u8_l_errorState;
+}
+
+/*******************************************************************************************************************************************************************/
+/*
+ Name: PWM_setFrequency
+ Input: u8 PortId, u8 PinId, u32 FrequencyHz, Pointer to u32 ReturnedFrequencyHz, and Pointer to u16 ReturnedDutySteps ( Pointers may be NULL )
+ Output: u8 Error or No Error
+ Description: Function to change the frequency of an initialized Channel at runtime, to the nearest F_CPU / ( Prescaler * 256 ),
+			  and report the generated frequency, and the duty resolution ( 256 timer steps per period in Fast PWM, reported as the 101 levels
+			  reachable through the 0 - 100% DutyCycle ).
+*/
+u8 PWM_setFrequency  ( u8 u8_a_portId, u8 u8_a_pinId, u32 u32_a_frequencyHz, u32 *pu32_a_returnedFrequencyHz, u16 *pu16_a_returnedDutySteps )
+{
+	/* Define local variable to set the error state = OK */
+	u8 u8_l_errorState = STD_TYPES_OK;
+	
+	u8  u8_l_channel = PWM_getChannel( u8_a_portId, u8_a_pinId );
+	u32 u32_l_frequency = 0;
+	
+	/* Check 1: Channel is initialized, and FrequencyHz is in the valid range */
+	if ( ( u8_l_channel != PWM_U8_NO_CHANNEL ) && ( GET_BIT( u8_gs_channelsMask, u8_l_channel ) ) &&
+		 ( u32_a_frequencyHz > 0 ) && ( u32_a_frequencyHz <= PWM_U32_MAX_FREQUENCY_HZ ) )
+	{
+		/* Check 1.1: Required Channel, only the Clock Select bits are changed */
+		switch ( u8_l_channel )
+		{
+			case PWM_U8_CHANNEL_OC0:
+				TMR_U8_TCCR0_REG = ( TMR_U8_TCCR0_REG & PWM_U8_CLOCK_SELECT_MASK ) |
+								   PWM_selectClock( Au16_gs_TMR0Prescalers, sizeof( Au16_gs_TMR0Prescalers ) / sizeof( Au16_gs_TMR0Prescalers[0] ), u32_a_frequencyHz, &u32_l_frequency );
+			break;
+			
+			case PWM_U8_CHANNEL_OC2:
+				TMR_U8_TCCR2_REG = ( TMR_U8_TCCR2_REG & PWM_U8_CLOCK_SELECT_MASK ) |
+								   PWM_selectClock( Au16_gs_TMR2Prescalers, sizeof( Au16_gs_TMR2Prescalers ) / sizeof( Au16_gs_TMR2Prescalers[0] ), u32_a_frequencyHz, &u32_l_frequency );
+			break;
+		}
+		
+		/* Step 1: Report the generated frequency and the duty resolution */
+		if ( pu32_a_returnedFrequencyHz != NULL ) *pu32_a_returnedFrequencyHz = u32_l_frequency;
+		if ( pu16_a_returnedDutySteps != NULL ) *pu16_a_returnedDutySteps = PWM_U16_EFFECTIVE_STEPS( MAX_COUNT );
+	}
+	/* Check 2: Channel is not initialized, or FrequencyHz is not in the valid range */
+	else
+	{
+		/* Update error state = NOK, wrong Channel or FrequencyHz! */
+		u8_l_errorState = STD_TYPES_NOK;
+	}
+	
+	return u8_l_errorState;
+}
+
+/*******************************************************************************************************************************************************************/
+/*
+ Name: PWM_generatePWM
+ Input: u8 DutyCycle
+ Output: u8 Error or No Error
+ Description: Function to Generate PWM on all initialized Channels.
+*/
+u8 PWM_generatePWM   ( u8 u8_a_dutyCycle )
+{
+	/* Define local variable to set the error state = OK */
+	u8 u8_l_errorState = STD_TYPES_OK;
+	
+	/* Check 1: DutyCycle is in the valid range */
+	if ( u8_a_dutyCycle <= PWM_U8_MAX_DUTY_CYCLE )
+	{
+		/* Loop: Until all initialized Channels are updated */
+		for ( u8 u8_l_channel = 0; u8_l_channel < PWM_U8_NUMBER_OF_CHANNELS; u8_l_channel++ )
+		{
+			if ( GET_BIT( u8_gs_channelsMask, u8_l_channel ) )
+			{
+				PWM_setChannelDuty( u8_l_channel, u8_a_dutyCycle );
+			}
+		}
+	}
+	/* Check 2: DutyCycle is not in the valid range */
+	else
+	{
+		/* Update error state = NOK, wrong DutyCycle! */
+		u8_l_errorState = STD_TYPES_NOK;
+	}
+	
+	return u8_l_errorState;
+}
+
+/*******************************************************************************************************************************************************************/
+/*
+ Name: PWM_generateChannelPWM
+ Input: u8 PortId, u8 PinId, and u8 DutyCycle
+ Output: u8 Error or No Error
+ Description: Function to Generate PWM on the initialized Channel of Port and Pin only.
+*/
+u8 PWM_generateChannelPWM( u8 u8_a_portId, u8 u8_a_pinId, u8 u8_a_dutyCycle )
+{
+	/* Define local variable to set the error state = OK */
+	u8 u8_l_errorState = STD_TYPES_OK;
+	
+	u8 u8_l_channel = PWM_getChannel( u8_a_portId, u8_a_pinId );
+	
+	/* Check 1: Channel is initialized, and DutyCycle is in the valid range */
+	if ( ( u8_l_channel != PWM_U8_NO_CHANNEL ) && ( GET_BIT( u8_gs_channelsMask, u8_l_channel ) ) && ( u8_a_dutyCycle <= PWM_U8_MAX_DUTY_CYCLE ) )
+	{
+		PWM_setChannelDuty( u8_l_channel, u8_a_dutyCycle );
+	}
+	/* Check 2: Channel is not initialized, or DutyCycle is not in the valid range */
+	else
+	{
+		/* Update error state = NOK, wrong Channel or DutyCycle! */
+		u8_l_errorState = STD_TYPES_NOK;
+	}
+	
+	return u8_l_errorState;
+}
+
+/*******************************************************************************************************************************************************************/
+/*
+ Name: PWM_getChannel
+ Input: u8 PortId and u8 PinId
+ Output: u8 Channel ( PWM_U8_NO_CHANNEL if Port and Pin are not OC0 or OC2 )
+ Description: Function to map Port and Pin on the Hardware Channel.
+*/
+static u8   PWM_getChannel     ( u8 u8_a_portId, u8 u8_a_pinId )
+{
+	if		( ( u8_a_portId == PWM_U8_OC0_PORT ) && ( u8_a_pinId == PWM_U8_OC0_PIN ) ) return PWM_U8_CHANNEL_OC0;
+	else if ( ( u8_a_portId == PWM_U8_OC2_PORT ) && ( u8_a_pinId == PWM_U8_OC2_PIN ) ) return PWM_U8_CHANNEL_OC2;
+	else																			   return PWM_U8_NO_CHANNEL;
+}
+
+/*******************************************************************************************************************************************************************/
+/*
+ Name: PWM_selectClock
+ Input: Pointer to u16 Prescalers, u8 NumberOfPrescalers, u32 Frequency ( in Hz ), and Pointer to u32 ReturnedFrequency ( in Hz )
+ Output: u8 Clock Select value
+ Description: Function to select the Prescaler giving the nearest Fast PWM frequency.
+*/
+static u8   PWM_selectClock    ( const u16 *pu16_a_prescalers, u8 u8_a_numberOfPrescalers, u32 u32_a_frequency, u32 *pu32_a_returnedFrequency )
+{
+	u32 u32_l_outputFrequency, u32_l_error, u32_l_bestError = 0xFFFFFFFF;
+	u8  u8_l_clockSelect = u8_a_numberOfPrescalers;
+	
+	/* Loop: Until all Prescalers are checked */
+	for ( u8 u8_l_index = 0; u8_l_index < u8_a_numberOfPrescalers; u8_l_index++ )
+	{
+		u32_l_outputFrequency = F_CPU / ( ( u32 ) pu16_a_prescalers[u8_l_index] * MAX_COUNT );
+		
+		u32_l_error = ( u32_l_outputFrequency > u32_a_frequency ) ? ( u32_l_outputFrequency - u32_a_frequency ) : ( u32_a_frequency - u32_l_outputFrequency );
+		
+		if ( u32_l_error < u32_l_bestError )
+		{
+			u32_l_bestError = u32_l_error;
+			u8_l_clockSelect = u8_l_index + 1;
+			*pu32_a_returnedFrequency = u32_l_outputFrequency;
+		}
+	}
+	
+	return u8_l_clockSelect;
+}
+
+/*******************************************************************************************************************************************************************/
+/*
+ Name: PWM_setChannelDuty
+ Input: u8 Channel and u8 DutyCycle
+ Output: void
+ Description: Function to stage the duty of one Channel, OCRn is double buffered by hardware and updated at the period end ( TOP ),
+			  OCn connection is changed by the OVF ISR at the period boundary, so there are no runt or stretched pulses.
+*/
+static void PWM_setChannelDuty ( u8 u8_a_channel, u8 u8_a_dutyCycle )
+{
+	u8 u8_l_compareValue = ( u8 ) ( ( ( u16 ) u8_a_dutyCycle * PWM_U8_OCR_TOP + ( PWM_U8_MAX_DUTY_CYCLE / 2 ) ) / PWM_U8_MAX_DUTY_CYCLE );
+	
+	/* Step 1: Stage OCn connection, DutyCycle zero is disconnected as Fast PWM would still output one clock pulse per period */
+	if ( u8_a_dutyCycle == 0 )
+	{
+		CLR_BIT( u8_gs_connectMask, u8_a_channel );
+	}
+	else
+	{
+		SET_BIT( u8_gs_connectMask, u8_a_channel );
+	}
+	
+	/* Check 1: Required Channel */
+	switch ( u8_a_channel )
+	{
+		case PWM_U8_CHANNEL_OC0:
+			/* Step 2: Set OCR0, buffered until TOP */
+			TMR_U8_OCR0_REG = u8_l_compareValue;
+			
+			/* Step 3: Commit OCn connection at the next overflow, if changed ( OVF flag may be old, clear it first ) */
+			if ( GET_BIT( TMR_U8_TCCR0_REG, TMR_U8_COM01_BIT ) != GET_BIT( u8_gs_connectMask, u8_a_channel ) )
+			{
+				if ( !GET_BIT( TMR_U8_TIMSK_REG, TMR_U8_TOIE0_BIT ) )
+				{
+					TMR_U8_TIFR_REG = ( 1 << TMR_U8_TOV0_BIT );
+					SET_BIT( TMR_U8_TIMSK_REG, TMR_U8_TOIE0_BIT );
+				}
+			}
+		break;
+		
+		case PWM_U8_CHANNEL_OC2:
+			/* Step 2: Set OCR2, buffered until TOP */
+			TMR_U8_OCR2_REG = u8_l_compareValue;
+			
+			/* Step 3: Commit OCn connection at the next overflow, if changed ( OVF flag may be old, clear it first ) */
+			if ( GET_BIT( TMR_U8_TCCR2_REG, TMR_U8_COM21_BIT ) != GET_BIT( u8_gs_connectMask, u8_a_channel ) )
+			{
+				if ( !GET_BIT( TMR_U8_TIMSK_REG, TMR_U8_TOIE2_BIT ) )
+				{
+					TMR_U8_TIFR_REG = ( 1 << TMR_U8_TOV2_BIT );
+					SET_BIT( TMR_U8_TIMSK_REG, TMR_U8_TOIE2_BIT );
+				}
+			}
+		break;
+	}
+}
+
+/*******************************************************************************************************************************************************************/
+/*
+ *  8-bit Timer/Counter0 and Timer/Counter2 ISRs
+ */
+/* ISR functions' prototypes of TMR0 and TMR2 Overflow ( OVF ) */
+void __vector_11( void )	__attribute__((signal));
+void __vector_5 ( void )	__attribute__((signal));
+
+/*******************************************************************************************************************************************************************/
+
+/* ISR function implementation of TMR0 OVF, period boundary: commit OC0 connection, then disable itself ( one shot ) */
+void __vector_11( void )
+{
+	if ( GET_BIT( u8_gs_connectMask, PWM_U8_CHANNEL_OC0 ) )
+	{
+		SET_BIT( TMR_U8_TCCR0_REG, TMR_U8_COM01_BIT );
+	}
+	else
+	{
+		CLR_BIT( TMR_U8_TCCR0_REG, TMR_U8_COM01_BIT );
+	}
+	
+	CLR_BIT( TMR_U8_TIMSK_REG, TMR_U8_TOIE0_BIT );
+}
+
+/* ISR function implementation of TMR2 OVF, period boundary: commit OC2 connection, then disable itself ( one shot ) */
+void __vector_5 ( void )
+{
+	if ( GET_BIT( u8_gs_connectMask, PWM_U8_CHANNEL_OC2 ) )
+	{
+		SET_BIT( TMR_U8_TCCR2_REG, TMR_U8_COM21_BIT );
+	}
+	else
+	{
+		CLR_BIT( TMR_U8_TCCR2_REG, TMR_U8_COM21_BIT );
+	}
+	
+	CLR_BIT( TMR_U8_TIMSK_REG, TMR_U8_TOIE2_BIT );
+}
+
+/*******************************************************************************************************************************************************************/
+
+#else
+
+/*******************************************************************************************************************************************************************/
+/* PWM Software Backend */
+
+/*******************************************************************************************************************************************************************/
+/* Declaration and Initialization */
+
+#if ( PWM_U32_PERIOD_CYCLES > ( 1024UL * MAX_COUNT ) )
+#error "PWM: PWM_U16_SOFTWARE_FREQUENCY_HZ is too low, one edge would not fit in TMR2 with 1024 prescaler"
+#endif
+
+#if ( PWM_U32_PERIOD_CYCLES < PWM_U16_SOFTWARE_MIN_PERIOD_CYCLES )
+#error "PWM: PWM_U16_SOFTWARE_FREQUENCY_HZ is too high, two TMR2 OVF ISRs per period would not fit in the period"
+#endif
+
+/* Timing Table Entry */
+typedef struct
+{
+	u8 u8_g_onClockSelect;
+	u8 u8_g_onInitialValue;
+	u8 u8_g_offClockSelect;
+	u8 u8_g_offInitialValue;
+} PWM_ST_TIMING;
+
 /* Global Variables to store Port and Pin values. */
 static u8 u8_gs_portId, u8_gs_pinId;
 
-/* Global Variables to store different values. */
-static u8 u8_gs_TonInitialValue, u8_gs_ToffInitialValue;
-static u16 u16_gs_TonPrescale, u16_gs_ToffPrescale;
-static f32 f32_gs_periodTime;
+/* Global Variables to store the DutyCycle of the running period, and the staged one committed by the ISR at the next period boundary */
+static volatile u8 u8_gs_dutyCycle = 0;
+static volatile u8 u8_gs_pendingDutyCycle = 0;
 
 /* Global Variable ( Flag ) to be altered when entering OVF interrupt in TMR2. */
 static volatile u8 u8_gs_PWMFlag = PWM_U8_FLAG_DOWN;
 
+/* Global Array of On and Off Clock Select and Initial values of every DutyCycle, computed at compile time and stored in flash */
+static const PWM_ST_TIMING Ast_gs_timings[PWM_U8_MAX_DUTY_CYCLE + 1] PROGMEM =
+{
+	PWM_TIMING(  0 ), PWM_TIMING(  1 ), PWM_TIMING(  2 ), PWM_TIMING(  3 ), PWM_TIMING(  4 ), PWM_TIMING(  5 ), PWM_TIMING(  6 ), PWM_TIMING(  7 ), PWM_TIMING(  8 ), PWM_TIMING(  9 ),
+	PWM_TIMING( 10 ), PWM_TIMING( 11 ), PWM_TIMING( 12 ), PWM_TIMING( 13 ), PWM_TIMING( 14 ), PWM_TIMING( 15 ), PWM_TIMING( 16 ), PWM_TIMING( 17 ), PWM_TIMING( 18 ), PWM_TIMING( 19 ),
+	PWM_TIMING( 20 ), PWM_TIMING( 21 ), PWM_TIMING( 22 ), PWM_TIMING( 23 ), PWM_TIMING( 24 ), PWM_TIMING( 25 ), PWM_TIMING( 26 ), PWM_TIMING( 27 ), PWM_TIMING( 28 ), PWM_TIMING( 29 ),
+	PWM_TIMING( 30 ), PWM_TIMING( 31 ), PWM_TIMING( 32 ), PWM_TIMING( 33 ), PWM_TIMING( 34 ), PWM_TIMING( 35 ), PWM_TIMING( 36 ), PWM_TIMING( 37 ), PWM_TIMING( 38 ), PWM_TIMING( 39 ),
+	PWM_TIMING( 40 ), PWM_TIMING( 41 ), PWM_TIMING( 42 ), PWM_TIMING( 43 ), PWM_TIMING( 44 ), PWM_TIMING( 45 ), PWM_TIMING( 46 ), PWM_TIMING( 47 ), PWM_TIMING( 48 ), PWM_TIMING( 49 ),
+	PWM_TIMING( 50 ), PWM_TIMING( 51 ), PWM_TIMING( 52 ), PWM_TIMING( 53 ), PWM_TIMING( 54 ), PWM_TIMING( 55 ), PWM_TIMING( 56 ), PWM_TIMING( 57 ), PWM_TIMING( 58 ), PWM_TIMING( 59 ),
+	PWM_TIMING( 60 ), PWM_TIMING( 61 ), PWM_TIMING( 62 ), PWM_TIMING( 63 ), PWM_TIMING( 64 ), PWM_TIMING( 65 ), PWM_TIMING( 66 ), PWM_TIMING( 67 ), PWM_TIMING( 68 ), PWM_TIMING( 69 ),
+	PWM_TIMING( 70 ), PWM_TIMING( 71 ), PWM_TIMING( 72 ), PWM_TIMING( 73 ), PWM_TIMING( 74 ), PWM_TIMING( 75 ), PWM_TIMING( 76 ), PWM_TIMING( 77 ), PWM_TIMING( 78 ), PWM_TIMING( 79 ),
+	PWM_TIMING( 80 ), PWM_TIMING( 81 ), PWM_TIMING( 82 ), PWM_TIMING( 83 ), PWM_TIMING( 84 ), PWM_TIMING( 85 ), PWM_TIMING( 86 ), PWM_TIMING( 87 ), PWM_TIMING( 88 ), PWM_TIMING( 89 ),
+	PWM_TIMING( 90 ), PWM_TIMING( 91 ), PWM_TIMING( 92 ), PWM_TIMING( 93 ), PWM_TIMING( 94 ), PWM_TIMING( 95 ), PWM_TIMING( 96 ), PWM_TIMING( 97 ), PWM_TIMING( 98 ), PWM_TIMING( 99 ),
+	PWM_TIMING( 100 )
+};
+
+#if ( PWM_U8_TIMING_BENCHMARK == 1 )
+/* Global Variables to store the Timing Benchmark results, volatile so the computed timings are not optimized away */
+static volatile u16 u16_gs_benchmarkPrescaler;
+static volatile u8  u8_gs_benchmarkInitialValue;
+
+/* Global Variable to store the Period ( in ms ) of the float timing math, as the former PWM_initialization did */
+static volatile f32 f32_gs_periodTime;
+#endif
+
+#if ( PWM_U8_ISR_LOAD_MEASURE == 1 )
+/* Global Variables to store the TMR2 OVF ISR run time ( in TCNT1 counts ) and the number of PWM periods, since the last PWM_getISRLoad */
+static volatile u32 u32_gs_ISRCounts = 0;
+static volatile u16 u16_gs_ISRPeriods = 0;
+#endif
+
 /*******************************************************************************************************************************************************************/
 /* PWM Private Functions' prototypes */
 
+static void PWM_loadTiming( u8 u8_a_dutyCycle, u8 u8_a_flag );
+
+#if ( PWM_U8_TIMING_BENCHMARK == 1 )
 static u8 PWM_calculatePrescaler   ( f32 f32_a_delay, u16 *pu16_a_returnedPrescaler );
-static u8 PWM_calculateInitialValue( u16 u16_a_prescaler, f32 f32_a_delay, u8 *pu16_a_returnedInitialValue );
-static u8 PWM_setPrescaler         ( u16 u16_a_prescaler );
+static u8 PWM_calculateInitialValue( u16 u16_a_prescaler, f32 f32_a_delay, u8 *pu8_a_returnedInitialValue );
+#endif
 
 /*******************************************************************************************************************************************************************/
 /*
  Name: PWM_initialization
- Input: u8 PortId, u8 PinId, and f32 PWMFrequency
+ Input: u8 PortId, u8 PinId, and f32 PWMFrequency ( in KHz, must match PWM_U16_SOFTWARE_FREQUENCY_HZ of the timing table )
  Output: u8 Error or No Error
  Description: Function to Initialize PWM peripheral.
 */
@@ -45,8 +450,10 @@ u8 PWM_initialization( u8 u8_a_portId, u8 u8_a_pinId, f32 f32_a_pwmFrequency )
 	/* Define local variable to set the error state = OK */
 	u8 u8_l_errorState = STD_TYPES_OK;
 
-	/* Check 1: PortId and PinlId are in the valid range */
-	if ( ( u8_a_portId <= DIO_U8_PORTD ) && ( u8_a_pinId <= DIO_U8_PIN7 ) )
+	/* Check 1: PortId and PinlId are in the valid range, and PWMFrequency is the one of the timing table ( within 1 Hz ) */
+	if ( ( u8_a_portId <= DIO_U8_PORTD ) && ( u8_a_pinId <= DIO_U8_PIN7 ) &&
+		 ( ( u16 ) ( f32_a_pwmFrequency * 1000.0F + 0.5F ) >= ( PWM_U16_SOFTWARE_FREQUENCY_HZ - 1 ) ) &&
+		 ( ( u16 ) ( f32_a_pwmFrequency * 1000.0F + 0.5F ) <= ( PWM_U16_SOFTWARE_FREQUENCY_HZ + 1 ) ) )
 	{
 		/* Step 1: Store Port and Pin ( through which PWM will be generated ) in Global Variables */
 		u8_gs_portId = u8_a_portId;
@@ -70,16 +477,13 @@ u8 PWM_initialization( u8 u8_a_portId, u8 u8_a_pinId, f32 f32_a_pwmFrequency )
 			case DIO_U8_PORTD: CLR_BIT( DIO_U8_PORTD_REG, u8_a_pinId ); break;
 		}		
 		
-		/* Step 4: Calculate Period ( Note: PWM Periodic Time is in milli seconds ) */
-		f32_gs_periodTime = 1.0F / f32_a_pwmFrequency;
-		
-		/* Step 5: Enable TMR2 Overflow Interrupt */
+		/* Step 4: Enable TMR2 Overflow Interrupt */
 		SET_BIT( TMR_U8_TIMSK_REG, TMR_U8_TOIE2_BIT );	
 	}
-	/* Check 2:PortId and PinlId is not in the valid range */
+	/* Check 2: PortId and PinlId are not in the valid range, or PWMFrequency is not the one of the timing table */
 	else
 	{
-		/* Update error state = NOK, wrong PortId and PinlId! */
+		/* Update error state = NOK, wrong PortId and PinlId, or PWMFrequency! */
 		u8_l_errorState = STD_TYPES_NOK;
 	}
 		
@@ -91,7 +495,8 @@ u8 PWM_initialization( u8 u8_a_portId, u8 u8_a_pinId, f32 f32_a_pwmFrequency )
  Name: PWM_generatePWM
  Input: u8 DutyCycle
  Output: u8 Error or No Error
- Description: Function to Generate PWM.
+ Description: Function to Generate PWM, On and Off timings are read from the compile time table ( no floating point math ),
+			  the running period is never changed, DutyCycle is committed by the ISR at the next period boundary.
 */
 u8 PWM_generatePWM   ( u8 u8_a_dutyCycle )
 {	 
@@ -101,42 +506,225 @@ u8 PWM_generatePWM   ( u8 u8_a_dutyCycle )
 	/* Check 1: DutyCycle is in the valid range */
 	if ( u8_a_dutyCycle <= PWM_U8_MAX_DUTY_CYCLE )
 	{
-		f32 f32_l_timeOn, f32_l_timeOff;
+		/* Step 1: Stage DutyCycle ( one byte write ), updates within one period coalesce and only the last one is committed */
+		u8_gs_pendingDutyCycle = u8_a_dutyCycle;
+		
+		/* Check 1.1: TMR2 is stopped, first call, start the first period with the On timing */
+		if ( ( TMR_U8_TCCR2_REG & ~PWM_U8_CLOCK_SELECT_MASK ) == 0 )
+		{
+			u8_gs_dutyCycle = u8_a_dutyCycle;
+			u8_gs_PWMFlag = PWM_U8_FLAG_DOWN;
+			
+			PWM_loadTiming( u8_a_dutyCycle, PWM_U8_FLAG_DOWN );
+		}
+	}
+	/* Check 2: DutyCycle is not in the valid range */
+	else
+	{
+		/* Update error state = NOK, wrong DutyCycle! */
+		u8_l_errorState = STD_TYPES_NOK;
+	}
+	
+	return u8_l_errorState;
+}
+
+/*******************************************************************************************************************************************************************/
+/*
+ Name: PWM_generateChannelPWM
+ Input: u8 PortId, u8 PinId, and u8 DutyCycle
+ Output: u8 Error or No Error
+ Description: Function to Generate PWM on Port and Pin, the Software Backend drives one ( the initialized ) Port and Pin only.
+*/
+u8 PWM_generateChannelPWM( u8 u8_a_portId, u8 u8_a_pinId, u8 u8_a_dutyCycle )
+{
+	/* Define local variable to set the error state = NOK */
+	u8 u8_l_errorState = STD_TYPES_NOK;
+	
+	/* Check 1: Port and Pin are the initialized ones */
+	if ( ( u8_a_portId == u8_gs_portId ) && ( u8_a_pinId == u8_gs_pinId ) )
+	{
+		u8_l_errorState = PWM_generatePWM( u8_a_dutyCycle );
+	}
+	
+	return u8_l_errorState;
+}
+
+/*******************************************************************************************************************************************************************/
+/*
+ Name: PWM_setFrequency
+ Input: u8 PortId, u8 PinId, u32 FrequencyHz, Pointer to u32 ReturnedFrequencyHz, and Pointer to u16 ReturnedDutySteps ( Pointers may be NULL )
+ Output: u8 Error or No Error
+ Description: Function to check the frequency of the Software Backend, timings are computed at compile time, so only
+			  PWM_U16_SOFTWARE_FREQUENCY_HZ is accepted, the duty resolution is the TMR2 steps of the period at the slowest edge prescaler,
+			  limited to the 101 levels reachable through the 0 - 100% DutyCycle.
+*/
+u8 PWM_setFrequency  ( u8 u8_a_portId, u8 u8_a_pinId, u32 u32_a_frequencyHz, u32 *pu32_a_returnedFrequencyHz, u16 *pu16_a_returnedDutySteps )
+{
+	/* Define local variable to set the error state = NOK */
+	u8 u8_l_errorState = STD_TYPES_NOK;
+	
+	/* Check 1: Port and Pin are the initialized ones, and FrequencyHz is the one of the timing table */
+	if ( ( u8_a_portId == u8_gs_portId ) && ( u8_a_pinId == u8_gs_pinId ) && ( u32_a_frequencyHz == PWM_U16_SOFTWARE_FREQUENCY_HZ ) )
+	{
+		if ( pu32_a_returnedFrequencyHz != NULL ) *pu32_a_returnedFrequencyHz = PWM_U16_SOFTWARE_FREQUENCY_HZ;
+		if ( pu16_a_returnedDutySteps != NULL ) *pu16_a_returnedDutySteps = PWM_U16_EFFECTIVE_STEPS( PWM_U32_PERIOD_CYCLES / PWM_U16_PRESCALER( PWM_U32_PERIOD_CYCLES ) );
 		
-		/* Step 1: Calculate Time Delay for both On & Off Time */
-		f32_l_timeOff = ( ( f32 ) f32_gs_periodTime * u8_a_dutyCycle ) / 100.0F;
-		f32_l_timeOn = f32_gs_periodTime - f32_l_timeOff;
+		u8_l_errorState = STD_TYPES_OK;
+	}
+	
+	return u8_l_errorState;
+}
+
+/*******************************************************************************************************************************************************************/
+/*
+ Name: PWM_loadTiming
+ Input: u8 DutyCycle and u8 Flag ( PWM_U8_FLAG_DOWN: On timing, PWM_U8_FLAG_UP: Off timing )
+ Output: void
+ Description: Function to load TMR2 Initial and Clock Select values of one DutyCycle edge from the flash table.
+*/
+static void PWM_loadTiming( u8 u8_a_dutyCycle, u8 u8_a_flag )
+{
+	u8 u8_l_clockSelect, u8_l_initialValue;
+	
+	/* Check 1: Required Flag */
+	if ( u8_a_flag == PWM_U8_FLAG_DOWN )
+	{
+		u8_l_clockSelect  = pgm_read_byte( &Ast_gs_timings[u8_a_dutyCycle].u8_g_onClockSelect );
+		u8_l_initialValue = pgm_read_byte( &Ast_gs_timings[u8_a_dutyCycle].u8_g_onInitialValue );
+	}
+	else
+	{
+		u8_l_clockSelect  = pgm_read_byte( &Ast_gs_timings[u8_a_dutyCycle].u8_g_offClockSelect );
+		u8_l_initialValue = pgm_read_byte( &Ast_gs_timings[u8_a_dutyCycle].u8_g_offInitialValue );
+	}
+	
+	TMR_U8_TCNT2_REG = u8_l_initialValue;
+	TMR_U8_TCCR2_REG = ( TMR_U8_TCCR2_REG & PWM_U8_CLOCK_SELECT_MASK ) | u8_l_clockSelect;
+}
+
+#if ( PWM_U8_ISR_LOAD_MEASURE == 1 )
+/*******************************************************************************************************************************************************************/
+/*
+ Name: PWM_getISRLoad
+ Input: Pointer to u32 ReturnedISRCycles and Pointer to u16 ReturnedPeriods
+ Output: u8 Error or No Error
+ Description: Function to report the CPU cycles spent in the TMR2 OVF ISR, and the number of PWM periods, since the last call, then restart counting
+			  ( TCNT1 resolution is PWM_U8_TCNT1_CYCLES_PER_COUNT cycles per ISR, it averages out over many periods, ISR entry and exit are not included ).
+*/
+u8 PWM_getISRLoad    ( u32 *pu32_a_returnedISRCycles, u16 *pu16_a_returnedPeriods )
+{
+	/* Define local variable to set the error state = OK */
+	u8 u8_l_errorState = STD_TYPES_OK;
+	
+	u8  u8_l_SREG;
+	u32 u32_l_ISRCounts;
+	
+	/* Check 1: Pointers are not equal to NULL */
+	if ( ( pu32_a_returnedISRCycles != NULL ) && ( pu16_a_returnedPeriods != NULL ) )
+	{
+		/* Step 1: Read and restart both counters at once, the ISR updates them */
+		u8_l_SREG = GLI_saveAndDisableGIE();
 		
-		/* Step 2: Calculate Prescaler Value for both On & Off Time */
-		PWM_calculatePrescaler( f32_l_timeOn, &u16_gs_TonPrescale );
-		PWM_calculatePrescaler( f32_l_timeOff, &u16_gs_ToffPrescale );
+		u32_l_ISRCounts = u32_gs_ISRCounts;
+		*pu16_a_returnedPeriods = u16_gs_ISRPeriods;
 		
-		/* Step 3: Calculate Initial Value for both On & Off Time */
-		PWM_calculateInitialValue( u16_gs_TonPrescale, f32_l_timeOn, &u8_gs_TonInitialValue );
-		PWM_calculateInitialValue( u16_gs_ToffPrescale, f32_l_timeOff, &u8_gs_ToffInitialValue );
+		u32_gs_ISRCounts = 0;
+		u16_gs_ISRPeriods = 0;
 		
-		/* Step 4: Set TMR2 Initial Value */
-		TMR_U8_TCNT2_REG = u8_gs_TonInitialValue;
+		GLI_restoreGIE( u8_l_SREG );
 		
-		/* Step 4: Set TMR2 Prescaler Value */
-		PWM_setPrescaler( u16_gs_TonPrescale );
+		/* Step 2: Convert TCNT1 counts to CPU cycles */
+		*pu32_a_returnedISRCycles = u32_l_ISRCounts * PWM_U8_TCNT1_CYCLES_PER_COUNT;
 	}
-	/* Check 2: DutyCycle is not in the valid range */
+	/* Check 2: Pointers are equal to NULL */
 	else
 	{
-		/* Update error state = NOK, wrong DutyCycle! */
+		/* Update error state = NOK, Pointer is NULL! */
 		u8_l_errorState = STD_TYPES_NOK;
 	}
 	
 	return u8_l_errorState;
 }
 
+#endif
+
+#if ( PWM_U8_TIMING_BENCHMARK == 1 )
+/*******************************************************************************************************************************************************************/
+/*
+ Name: PWM_benchmarkTiming
+ Input: u8 Method ( PWM_U8_TIMING_FLOAT or PWM_U8_TIMING_TABLE )
+ Output: u8 Error or No Error
+ Description: Function to compute the On and Off timings of all DutyCycles, with the float math of the former PWM_generatePWM or from the flash table,
+			  to be timed by the caller, TMR2 registers are not written ( by both Methods ), so the running PWM is not changed.
+*/
+u8 PWM_benchmarkTiming( u8 u8_a_method )
+{
+	/* Define local variable to set the error state = OK */
+	u8 u8_l_errorState = STD_TYPES_OK;
+	
+	u16 u16_l_prescaler;
+	u8  u8_l_initialValue;
+	f32 f32_l_timeOn, f32_l_timeOff;
+	
+	/* Check 1: Required Method */
+	switch ( u8_a_method )
+	{
+		/* Case 1: Float math, Period is computed once, as in the former PWM_initialization */
+		case PWM_U8_TIMING_FLOAT:
+			f32_gs_periodTime = 1000.0F / PWM_U16_SOFTWARE_FREQUENCY_HZ;
+			
+			/* Loop: Until the timings of all DutyCycles are computed */
+			for ( u8 u8_l_dutyCycle = 0; u8_l_dutyCycle <= PWM_U8_MAX_DUTY_CYCLE; u8_l_dutyCycle++ )
+			{
+				/* Step 1: Calculate Time Delay for both On & Off Time */
+				f32_l_timeOff = ( ( f32 ) f32_gs_periodTime * u8_l_dutyCycle ) / 100.0F;
+				f32_l_timeOn = f32_gs_periodTime - f32_l_timeOff;
+				
+				/* Step 2: Calculate Prescaler and Initial Value of On Time */
+				PWM_calculatePrescaler( f32_l_timeOn, &u16_l_prescaler );
+				PWM_calculateInitialValue( u16_l_prescaler, f32_l_timeOn, &u8_l_initialValue );
+				u16_gs_benchmarkPrescaler = u16_l_prescaler;
+				u8_gs_benchmarkInitialValue = u8_l_initialValue;
+				
+				/* Step 3: Calculate Prescaler and Initial Value of Off Time */
+				PWM_calculatePrescaler( f32_l_timeOff, &u16_l_prescaler );
+				PWM_calculateInitialValue( u16_l_prescaler, f32_l_timeOff, &u8_l_initialValue );
+				u16_gs_benchmarkPrescaler = u16_l_prescaler;
+				u8_gs_benchmarkInitialValue = u8_l_initialValue;
+			}
+		break;
+		
+		/* Case 2: Flash table, as PWM_loadTiming */
+		case PWM_U8_TIMING_TABLE:
+			/* Loop: Until the timings of all DutyCycles are read */
+			for ( u8 u8_l_dutyCycle = 0; u8_l_dutyCycle <= PWM_U8_MAX_DUTY_CYCLE; u8_l_dutyCycle++ )
+			{
+				/* Step 1: Read Clock Select and Initial Value of On Time */
+				u16_gs_benchmarkPrescaler = pgm_read_byte( &Ast_gs_timings[u8_l_dutyCycle].u8_g_onClockSelect );
+				u8_gs_benchmarkInitialValue = pgm_read_byte( &Ast_gs_timings[u8_l_dutyCycle].u8_g_onInitialValue );
+				
+				/* Step 2: Read Clock Select and Initial Value of Off Time */
+				u16_gs_benchmarkPrescaler = pgm_read_byte( &Ast_gs_timings[u8_l_dutyCycle].u8_g_offClockSelect );
+				u8_gs_benchmarkInitialValue = pgm_read_byte( &Ast_gs_timings[u8_l_dutyCycle].u8_g_offInitialValue );
+			}
+		break;
+		
+		/* Case 3: Wrong Method */
+		default:
+			/* Update error state = NOK, wrong Method! */
+			u8_l_errorState = STD_TYPES_NOK;
+		break;
+	}
+	
+	return u8_l_errorState;
+}
+
 /*******************************************************************************************************************************************************************/
 /*
  Name: PWM_calculatePrescaler
  Input: f32 Delay and Pointer to u16 ReturnedPrescaler
  Output: u8 Error or No Error
- Description: Function to calculate Prescaler value.
+ Description: Function to calculate Prescaler value ( float math of the former PWM_generatePWM, Timing Benchmark only ).
 */
 static u8 PWM_calculatePrescaler   ( f32 f32_a_delay, u16 *pu16_a_returnedPrescaler )
 {
@@ -200,48 +788,41 @@ static u8 PWM_calculatePrescaler   ( f32 f32_a_delay, u16 *pu16_a_returnedPresca
 /*******************************************************************************************************************************************************************/
 /*
  Name: PWM_calculateInitialValue
- Input: u16 Prescaler, f32 Delay, and Pointer to u16 ReturnedPrescaler
+ Input: u16 Prescaler, f32 Delay, and Pointer to u8 ReturnedInitialValue
  Output: u8 Error or No Error
- Description: Function to calculate Initial value.
+ Description: Function to calculate Initial value ( float math of the former PWM_generatePWM, Timing Benchmark only ).
 */
-static u8 PWM_calculateInitialValue( u16 u16_a_prescaler, f32 f32_a_delay, u8 *pu16_a_returnedInitialValue )
+static u8 PWM_calculateInitialValue( u16 u16_a_prescaler, f32 f32_a_delay, u8 *pu8_a_returnedInitialValue )
 {
 	/* Define local variable to set the error state = OK */
 	u8 u8_l_errorState = STD_TYPES_OK;
-		
+	
 	/* Check 1: Prescaler is in the valid range, and Pointer is not equal to NULL */
-	if( ( u16_a_prescaler <= TMR_U16_TMR_2_1024_PRESCALER ) && ( pu16_a_returnedInitialValue != NULL ) )
+	if( ( u16_a_prescaler <= TMR_U16_TMR_2_1024_PRESCALER ) && ( pu8_a_returnedInitialValue != NULL ) )
 	{
 		/* Check 1.1: Required Prescaler */
 		switch( u16_a_prescaler )
 		{
-			/* Case 1: No Prescaler */
 			case TMR_U16_TMR_2_NO_PRESCALER:
-				*pu16_a_returnedInitialValue = INITITAL_VALUE( MAX_DELAY_MS( TMR_U16_TMR_2_NO_PRESCALER ), f32_a_delay, MIN_DELAY_MS( TMR_U16_TMR_2_NO_PRESCALER ) );
+				*pu8_a_returnedInitialValue = INITITAL_VALUE( MAX_DELAY_MS( TMR_U16_TMR_2_NO_PRESCALER ), f32_a_delay, MIN_DELAY_MS( TMR_U16_TMR_2_NO_PRESCALER ) );
 			break;
-			/* Case 2: Prescaler is 8 */
 			case TMR_U16_TMR_2_8_PRESCALER:
-				*pu16_a_returnedInitialValue = INITITAL_VALUE( MAX_DELAY_MS( TMR_U16_TMR_2_8_PRESCALER ), f32_a_delay, MIN_DELAY_MS( TMR_U16_TMR_2_8_PRESCALER ) );
+				*pu8_a_returnedInitialValue = INITITAL_VALUE( MAX_DELAY_MS( TMR_U16_TMR_2_8_PRESCALER ), f32_a_delay, MIN_DELAY_MS( TMR_U16_TMR_2_8_PRESCALER ) );
 			break;
-			/* Case 3: Prescaler is 32 */
 			case TMR_U16_TMR_2_32_PRESCALER:
-				*pu16_a_returnedInitialValue = INITITAL_VALUE( MAX_DELAY_MS( TMR_U16_TMR_2_32_PRESCALER ), f32_a_delay, MIN_DELAY_MS( TMR_U16_TMR_2_32_PRESCALER ) );
+				*pu8_a_returnedInitialValue = INITITAL_VALUE( MAX_DELAY_MS( TMR_U16_TMR_2_32_PRESCALER ), f32_a_delay, MIN_DELAY_MS( TMR_U16_TMR_2_32_PRESCALER ) );
 			break;
-			/* Case 4: Prescaler is 64 */
 			case TMR_U16_TMR_2_64_PRESCALER:
-				*pu16_a_returnedInitialValue = INITITAL_VALUE( MAX_DELAY_MS( TMR_U16_TMR_2_64_PRESCALER ), f32_a_delay, MIN_DELAY_MS( TMR_U16_TMR_2_64_PRESCALER ) );
+				*pu8_a_returnedInitialValue = INITITAL_VALUE( MAX_DELAY_MS( TMR_U16_TMR_2_64_PRESCALER ), f32_a_delay, MIN_DELAY_MS( TMR_U16_TMR_2_64_PRESCALER ) );
 			break;
-			/* Case 5: Prescaler is 128 */
 			case TMR_U16_TMR_2_128_PRESCALER:
-				*pu16_a_returnedInitialValue = INITITAL_VALUE( MAX_DELAY_MS( TMR_U16_TMR_2_128_PRESCALER ), f32_a_delay, MIN_DELAY_MS( TMR_U16_TMR_2_128_PRESCALER ) );
+				*pu8_a_returnedInitialValue = INITITAL_VALUE( MAX_DELAY_MS( TMR_U16_TMR_2_128_PRESCALER ), f32_a_delay, MIN_DELAY_MS( TMR_U16_TMR_2_128_PRESCALER ) );
 			break;
-			/* Case 6: Prescaler is 256 */
 			case TMR_U16_TMR_2_256_PRESCALER:
-				*pu16_a_returnedInitialValue = INITITAL_VALUE( MAX_DELAY_MS( TMR_U16_TMR_2_256_PRESCALER ), f32_a_delay, MIN_DELAY_MS( TMR_U16_TMR_2_256_PRESCALER ) );
+				*pu8_a_returnedInitialValue = INITITAL_VALUE( MAX_DELAY_MS( TMR_U16_TMR_2_256_PRESCALER ), f32_a_delay, MIN_DELAY_MS( TMR_U16_TMR_2_256_PRESCALER ) );
 			break;
-			/* Case 7: Prescaler is 1024 */
 			case TMR_U16_TMR_2_1024_PRESCALER:
-				*pu16_a_returnedInitialValue = INITITAL_VALUE ( MAX_DELAY_MS( TMR_U16_TMR_2_1024_PRESCALER ), f32_a_delay, MIN_DELAY_MS( TMR_U16_TMR_2_1024_PRESCALER ) );
+				*pu8_a_returnedInitialValue = INITITAL_VALUE( MAX_DELAY_MS( TMR_U16_TMR_2_1024_PRESCALER ), f32_a_delay, MIN_DELAY_MS( TMR_U16_TMR_2_1024_PRESCALER ) );
 			break;
 		}
 	}
@@ -251,63 +832,13 @@ static u8 PWM_calculateInitialValue( u16 u16_a_prescaler, f32 f32_a_delay, u8 *p
 		/* Update error state = NOK, wrong Prescaler or Pointer is NULL! */
 		u8_l_errorState = STD_TYPES_NOK;
 	}
-		
+	
 	return u8_l_errorState;
 }
 
-/*******************************************************************************************************************************************************************/
-/*
- Name: PWM_setPrescaler
- Input: u16 Prescaler
- Output: u8 Error or No Error
- Description: Function to Set Prescaler value.
-*/
-static u8 PWM_setPrescaler         ( u16 u16_a_prescaler )
-{
-	/* Define local variable to set the error state = OK */
-	u8 u8_l_errorState = STD_TYPES_OK;
-		
-	/* Check 1: Prescaler is in the valid range */
-	if ( u16_a_prescaler <= TMR_U16_TMR_2_1024_PRESCALER )
-	{
-		/* Check 1.1: Required Prescaler */
-		switch ( u16_a_prescaler )
-		{
-			/* Case 1: Clock Source =  No Prescaler */
-			case TMR_U16_TMR_2_NO_PRESCALER	  : SET_BIT( TMR_U8_TCCR2_REG, TMR_U8_CS20_BIT ); CLR_BIT( TMR_U8_TCCR2_REG, TMR_U8_CS21_BIT );
-											    CLR_BIT( TMR_U8_TCCR2_REG, TMR_U8_CS22_BIT ); break;
-			/* Case 2: Clock Source = 8 Prescaler */
-			case TMR_U16_TMR_2_8_PRESCALER	  : CLR_BIT( TMR_U8_TCCR2_REG, TMR_U8_CS20_BIT ); SET_BIT( TMR_U8_TCCR2_REG, TMR_U8_CS21_BIT );
-											    CLR_BIT( TMR_U8_TCCR2_REG, TMR_U8_CS22_BIT ); break;
-			/* Case 3: Clock = 32 Prescaler */
-			case TMR_U16_TMR_2_32_PRESCALER	  : SET_BIT( TMR_U8_TCCR2_REG, TMR_U8_CS20_BIT ); SET_BIT( TMR_U8_TCCR2_REG, TMR_U8_CS21_BIT );
-												CLR_BIT( TMR_U8_TCCR2_REG, TMR_U8_CS22_BIT ); break;
-			/* Case 4: Clock Source = 64 Prescaler */
-			case TMR_U16_TMR_2_64_PRESCALER	  : CLR_BIT( TMR_U8_TCCR2_REG, TMR_U8_CS20_BIT ); CLR_BIT( TMR_U8_TCCR2_REG, TMR_U8_CS21_BIT );
-												SET_BIT( TMR_U8_TCCR2_REG, TMR_U8_CS22_BIT ); break;
-			/* Case 5: Clock Source = 128 Prescaler */
-			case TMR_U16_TMR_2_128_PRESCALER  : SET_BIT( TMR_U8_TCCR2_REG, TMR_U8_CS20_BIT ); CLR_BIT( TMR_U8_TCCR2_REG, TMR_U8_CS21_BIT );
-												SET_BIT( TMR_U8_TCCR2_REG, TMR_U8_CS22_BIT ); break;
-			/* Case 6: Clock Source = 256 Prescaler */
-			case TMR_U16_TMR_2_256_PRESCALER  : CLR_BIT( TMR_U8_TCCR2_REG, TMR_U8_CS20_BIT ); SET_BIT( TMR_U8_TCCR2_REG, TMR_U8_CS21_BIT );
-												SET_BIT( TMR_U8_TCCR2_REG, TMR_U8_CS22_BIT ); break;
-			/* Case 7: Clock Source = 1024 Prescaler */
-			case TMR_U16_TMR_2_1024_PRESCALER : SET_BIT( TMR_U8_TCCR2_REG, TMR_U8_CS20_BIT ); SET_BIT( TMR_U8_TCCR2_REG, TMR_U8_CS21_BIT );
-												SET_BIT( TMR_U8_TCCR2_REG, TMR_U8_CS22_BIT ); break;
-		}
-	}
-	/* Check 2: Prescaler is not in the valid range */
-	else
-	{
-		/* Update error state = NOK, wrong Prescaler! */
-		u8_l_errorState = STD_TYPES_NOK;
-	}
-		
-	return u8_l_errorState;
-}
+#endif
 
 /*******************************************************************************************************************************************************************/
-
 /*
  *  8-bit Timer/Counter2 ISR
  */
@@ -319,21 +850,29 @@ void __vector_5( void )		__attribute__((signal));
 /* ISR function implementation of TMR2 OVF */
 void __vector_5( void )
 {
+	#if ( PWM_U8_ISR_LOAD_MEASURE == 1 )
+	u16 u16_l_startCount = TMR_U16_TCNT1_REG;
+	#endif
+	
 	/* Check 1: PWMFlag is not set */
 	if( u8_gs_PWMFlag == PWM_U8_FLAG_DOWN )
 	{
-		PWM_setPrescaler( u16_gs_ToffPrescale );		
-		TMR_U8_TCNT2_REG = u8_gs_ToffInitialValue;
+		PWM_loadTiming( u8_gs_dutyCycle, PWM_U8_FLAG_UP );
 		
 		u8_gs_PWMFlag = PWM_U8_FLAG_UP;
 	}
-	/* Check 2: PWMFlag is set */
+	/* Check 2: PWMFlag is set, period boundary, commit the staged DutyCycle */
 	else
 	{
-		PWM_setPrescaler( u16_gs_TonPrescale );		
-		TMR_U8_TCNT2_REG = u8_gs_TonInitialValue;
+		u8_gs_dutyCycle = u8_gs_pendingDutyCycle;
+		
+		PWM_loadTiming( u8_gs_dutyCycle, PWM_U8_FLAG_DOWN );
 		
 		u8_gs_PWMFlag = PWM_U8_FLAG_DOWN;
+		
+		#if ( PWM_U8_ISR_LOAD_MEASURE == 1 )
+		u16_gs_ISRPeriods++;
+		#endif
 	}
 
 	/* Step 2: Toggle the PWM Pin */
@@ -344,6 +883,13 @@ void __vector_5( void )
 		case DIO_U8_PORTC: TOG_BIT( DIO_U8_PORTC_REG, u8_gs_pinId ); break;
 		case DIO_U8_PORTD: TOG_BIT( DIO_U8_PORTD_REG, u8_gs_pinId ); break;
 	}
+	
+	#if ( PWM_U8_ISR_LOAD_MEASURE == 1 )
+	/* Step 3: Accumulate the ISR run time ( TCNT1 is free running, u16 subtraction wraps ) */
+	u32_gs_ISRCounts += ( u16 ) ( TMR_U16_TCNT1_REG - u16_l_startCount );
+	#endif
 }
 
-/*******************************************************************************************************************************************************************/
\ No newline at end of file
+/*******************************************************************************************************************************************************************/
+
+#endif
@@ -18,7 +18,14 @@
 
 
 /*============= MACRO DEFINITION =============*/
+#define SYSTEM_TICK_TMR1_PRESCALER	P_8
+#define SYSTEM_TICK_TMR1_COUNTS		(F_CPU/SYSTEM_TICK_TMR1_PRESCALER/1000UL)		//timer1 counts of 1 ms tick
+#define SYSTEM_TICK_TMR1_US_PER_COUNT	((SYSTEM_TICK_TMR1_PRESCALER*1000000UL)/F_CPU)	//timer count resolution in us
+#define MAX_TMR1_TICK_CALLBACKS		2		//number of functions called back on every system tick
 
+#if (SYSTEM_TICK_TMR1_COUNTS > 65535) || ((F_CPU % (SYSTEM_TICK_TMR1_PRESCALER*1000UL)) != 0)
+#error "TMR1 system tick: F_CPU does not give an exact 1 ms tick with the selected prescaler"
+#endif
 
 /*============= TYPE DEFINITION =============*/
 typedef enum{
@@ -48,6 +55,10 @@ typedef enum{
 typedef enum{
 	Normal,PWM,CTC=4,FAST_PWM,MAX_MODE=15
 	}EN_TMR2_MODE;
+
+typedef enum{
+	CHANNEL_A,CHANNEL_B		//OC1A (PD5), OC1B (PD4)
+	}EN_TMR1_CMP_CHANNEL;
 	
 typedef struct{
 	EN_TMR2_MODE TMR_mode;
@@ -65,6 +76,76 @@ void TMR1_init (ST_TME1_ConfigType* TMR_config);
 u16 TMR1_readTime(void);
 void TMR1_clear(void);
 void TMR1_stop(void);
+
+/*
+Description:use to enable one timer1 interrupt source without changing timer configuration
+*/
+void TMR1_enableInterrupt(EN_TMR_INT INT_source);
+
+/*
+Description:use to disable one timer1 interrupt source without changing timer configuration
+*/
+void TMR1_disableInterrupt(EN_TMR_INT INT_source);
+
+/*
+Description:use to read Input Capture Register ICR1, timer value latched by hardware on the ICP1 (PD6) edge
+*/
+u16 TMR1_readCapture(void);
+
+/*
+Description:use to change input capture edge, pending capture flag is cleared as the datasheet requires after changing ICES1
+*/
+void TMR1_setCaptureEdge(EN_TME_CAPT_EDGE edge);
+
+/*
+Description:use to generate one high pulse of <width> timer counts on OC1A/OC1B in normal mode, without ISR or busy wait
+CHANNEL_B is not available while the system tick is running on timer1
+pin is forced high now and cleared by hardware on compare match, pin direction must be output
+to be called with interrupts disabled, and timer running
+*/
+void TMR1_generatePulse(EN_TMR1_CMP_CHANNEL channel,u16 width);
+
+/*
+Description:use to get timer1 clock source, NO_CLK if timer1 is stopped
+*/
+EN_TMR_CLK TMR1_getClock(void);
+
+/*
+Description:use to start 1 ms system tick using channel B compare match on the free running timer1
+timer1 keeps running in normal mode at CLK_8 and is never cleared, so it is still shared with the ICU and OC1A pulses
+timer1 is started if stopped, it must not be running with another clock or mode
+OC1B (PD4) stays a normal port pin, calling it again while the tick is running has no effect
+*/
+void TMR1_startSystemTick(void);
+
+/*
+Description:use to check if the system tick is running on timer1 (timer1 must not be stopped then)
+*/
+u8 TMR1_isSystemTickRunning(void);
+
+/*
+Description:use to add a function called back from the compare match ISR on every tick
+return TRUE if added, FALSE if all MAX_TMR1_TICK_CALLBACKS are used or pointer is NULL
+*/
+u8 TMR1_addTickCallBack(void(*g_ptr)(void));
+
+/*
+Description:use to get number of elapsed system ticks (ms) since TMR1_startSystemTick
+wraps after 49.7 days
+*/
+u32 TMR1_getTicks(void);
+
+/*
+Description:use to get elapsed time in microseconds since TMR1_startSystemTick
+resolution is SYSTEM_TICK_TMR1_US_PER_COUNT (1 us at 8 MHz), wraps after 71.6 minutes
+safe to call with interrupts disabled (inside ISR) for up to 65 ms, holds interrupts off for the TCNT1 read (a few cycles)
+*/
+u32 TMR1_getMicros(void);
+
+/*
+Description:use to set function called back from input capture ISR (INPUT_CAPT interrupt must be enabled)
+*/
+void TMR1_setCaptureCallBack(void(*g_ptr)(void));
 #endif /* TMR1_INTERFACE_H_ */
 
 
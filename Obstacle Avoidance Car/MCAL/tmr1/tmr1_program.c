@@ -17,6 +17,17 @@
 #define WGM_HIGH_MASKING	0x0C
 #define INT_MASKING_BITS	0xC3
 #define ZERO_VALUE			0
+#define WGM_HIGH_SHIFT		2
+#define COMA_MASKING_BITS	0x3F
+#define COMB_MASKING_BITS	0xCF
+#define CLK_BITS			0x07
+
+/*============= global variables =============*/
+static void (*g_captureCallBackPtr)(void) = NULL;
+static void (*g_tickCallBackPtr[MAX_TMR1_TICK_CALLBACKS])(void) = {NULL};
+static volatile u8 g_tick_running=0;			//set once system tick is started
+static volatile u32 g_system_ticks=0;			//number of elapsed system ticks (ms)
+static volatile u16 g_tick_time=0;				//timer1 value of the last tick
 /*============= FUNCTION DEFINITION =============*/
 
 void TMR1_init (ST_TME1_ConfigType* TMR_config)
@@ -36,9 +47,12 @@ void TMR1_init (ST_TME1_ConfigType* TMR_config)
 	TCCR1B = (TCCR1B & NOISE_MASKING_BITS) | ((TMR_config->NO_Noise) << ICNC1);
 	//set wave generation mode
 	TCCR1A = (TCCR1A & WGMA_MASKING_BITS) | (TMR_config->TMR_mode & WGM_LOW_MASKING);
-	TCCR1B = (TCCR1B & WGMB_MASKING_BITS) | ((TMR_config->TMR_mode & WGM_HIGH_MASKING) << WGM12);
-	//interrupt source
-	TIMSK = ((TIMSK & INT_MASKING_BITS) | (TMR_config->INT_source)) && (TMR_config->INT_state);
+	TCCR1B = (TCCR1B & WGMB_MASKING_BITS) | (((TMR_config->TMR_mode & WGM_HIGH_MASKING) >> WGM_HIGH_SHIFT) << WGM12);
+	//interrupt source (keep timer0 and timer2 interrupt bits untouched)
+	if(TMR_config->INT_state == Enable)
+		TIMSK = (TIMSK & INT_MASKING_BITS) | (TMR_config->INT_source);
+	else
+		TIMSK &= INT_MASKING_BITS;
 	//he FOC1A/FOC1B bits are only active when the WGM13:0 bits specifies a non-PWM mode
 	if(TMR_config->TMR_mode == Normal || TMR_config->TMR_mode == CTC)
 	{
@@ -60,6 +74,145 @@ void TMR1_stop(void)
 {
 	//stop timer clock
 	TCCR1B=ZERO_VALUE;
-	//clear timer interrupt 
-	TIMSK=ZERO_VALUE;
-}
\ No newline at end of file
+	//clear timer interrupt (keep timer0 and timer2 interrupt bits untouched)
+	TIMSK &= INT_MASKING_BITS;
+}
+
+void TMR1_enableInterrupt(EN_TMR_INT INT_source)
+{
+	TIMSK |= (INT_source & ~INT_MASKING_BITS);
+}
+
+void TMR1_disableInterrupt(EN_TMR_INT INT_source)
+{
+	TIMSK &= ~(INT_source & ~INT_MASKING_BITS);
+}
+
+u16 TMR1_readCapture(void)
+{
+	//return input capture register
+	return ICR1;
+}
+
+void TMR1_setCaptureEdge(EN_TME_CAPT_EDGE edge)
+{
+	TCCR1B = (TCCR1B & CAPT_MASKING_BITS) | (edge << ICES1);
+	//clear capture flag, edge change may set it
+	TIFR = (1<<ICF1);
+}
+
+void TMR1_generatePulse(EN_TMR1_CMP_CHANNEL channel,u16 width)
+{
+	if(channel == CHANNEL_A)
+	{
+		//force set now, then let compare match clear the pin (current count is partially elapsed, so add one)
+		TCCR1A = (TCCR1A & COMA_MASKING_BITS) | (CMP_set << COM1A0);
+		TCCR1A |= (1<<FOC1A);
+		OCR1A = TCNT1 + width + 1;
+		TCCR1A = (TCCR1A & COMA_MASKING_BITS) | (CMP_clear << COM1A0);
+	}
+	else
+	{
+		TCCR1A = (TCCR1A & COMB_MASKING_BITS) | (CMP_set << COM1B0);
+		TCCR1A |= (1<<FOC1B);
+		OCR1B = TCNT1 + width + 1;
+		TCCR1A = (TCCR1A & COMB_MASKING_BITS) | (CMP_clear << COM1B0);
+	}
+}
+
+EN_TMR_CLK TMR1_getClock(void)
+{
+	return (EN_TMR_CLK)(TCCR1B & CLK_BITS);
+}
+
+void TMR1_startSystemTick(void)
+{
+	if(!g_tick_running)
+	{
+		if(TMR1_getClock() == NO_CLK)
+		{
+			//normal mode, OC1A/OC1B disconnected, noise canceler on as input capture shares this timebase
+			TCNT1 = ZERO_VALUE;
+			TCCR1A = (1<<FOC1A) | (1<<FOC1B);
+			TCCR1B = (1<<ICNC1) | CLK_8;
+		}
+		g_system_ticks=0;
+		g_tick_time=TCNT1;
+		OCR1B=g_tick_time+SYSTEM_TICK_TMR1_COUNTS;
+		TIFR = (1<<OCF1B);				//clear any pending compare match (write one to clear, other flags untouched)
+		g_tick_running=1;
+		TMR1_enableInterrupt(COMP_B);
+	}
+}
+
+u8 TMR1_isSystemTickRunning(void)
+{
+	return g_tick_running;
+}
+
+u8 TMR1_addTickCallBack(void(*g_ptr)(void))
+{
+	u8 index;
+	if(g_ptr != NULL)
+	{
+		for(index=0;index<MAX_TMR1_TICK_CALLBACKS;index++)
+		{
+			if(g_tickCallBackPtr[index] == NULL)
+			{
+				g_tickCallBackPtr[index]=g_ptr;
+				return TRUE;
+			}
+		}
+	}
+	return FALSE;
+}
+
+u32 TMR1_getTicks(void)
+{
+	u32 ticks;
+	//read again if tick ISR updated the counter in the middle of the read
+	do{
+		ticks=g_system_ticks;
+	}while(ticks != g_system_ticks);
+	return ticks;
+}
+
+u32 TMR1_getMicros(void)
+{
+	u32 ticks;
+	u16 elapsed;
+	u8 sreg=SREG;
+	//interrupts held off: tick ISR can not update ticks in the middle of the read, and capture ISR can not
+	//overwrite the shared 16-bit TEMP register between the TCNT1 low and high byte accesses
+	SREG&=~(1<<SREG_I);
+	ticks=g_system_ticks;
+	elapsed=TCNT1-g_tick_time;
+	SREG=sreg;						//restore global interrupt state, so it is still safe inside an ISR
+	//counts since the last served tick, a pending compare match is already included in <elapsed>
+	return (ticks*1000UL) + ((u32)elapsed*SYSTEM_TICK_TMR1_US_PER_COUNT);
+}
+
+void TMR1_setCaptureCallBack(void(*g_ptr)(void))
+{
+	g_captureCallBackPtr=g_ptr;
+}
+
+ISR_HANDLER(TMR1_CPT)
+{
+	if(g_captureCallBackPtr != NULL)
+		g_captureCallBackPtr();
+}
+
+ISR_HANDLER(TMR1_CMP_B)
+{
+	u8 index;
+	//next tick is one period after the previous compare, not after this ISR, so latency never accumulates
+	g_tick_time+=SYSTEM_TICK_TMR1_COUNTS;
+	OCR1B=g_tick_time+SYSTEM_TICK_TMR1_COUNTS;
+	g_system_ticks++;
+	for(index=0;index<MAX_TMR1_TICK_CALLBACKS;index++)
+	{
+		if(g_tickCallBackPtr[index] != NULL)
+			g_tickCallBackPtr[index]();
+	}
+}